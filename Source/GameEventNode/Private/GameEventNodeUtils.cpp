@@ -221,9 +221,9 @@ void UGameEventNodeUtils::AddListener_ByFuncName(UObject* WorldContextObject, co
 	Listener.Receiver = WorldContextObject;
 	Listener.FunctionName = FunctionName;
 
-	if (FGameEventManager::Get().IsValid())
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(WorldContextObject))
 	{
-		FGameEventManager::Get()->AddListener(FEventId(EventName), Listener);
+		Manager->AddListener(FEventId(EventName), Listener);
 	}
 }
 
@@ -238,9 +238,9 @@ void UGameEventNodeUtils::AddListener_ByDelegate(UObject* WorldContextObject, co
 	Listener.Receiver = WorldContextObject;
 	Listener.PropertyDelegate = PropertyDelegate;
 
-	if (FGameEventManager::Get().IsValid())
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(WorldContextObject))
 	{
-		FGameEventManager::Get()->AddListener(FEventId(EventName), Listener);
+		Manager->AddListener(FEventId(EventName), Listener);
 	}
 }
 
@@ -251,13 +251,13 @@ void UGameEventNodeUtils::RemoveListener(UObject* WorldContextObject, const FStr
 		return;
 	}
 
-	if (FGameEventManager::Get().IsValid())
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(WorldContextObject))
 	{
-		FGameEventManager::Get()->RemoveAllListenersForReceiver(FEventId(EventName), WorldContextObject);
+		Manager->RemoveAllListenersForReceiver(FEventId(EventName), WorldContextObject);
 	}
 }
 
-void UGameEventNodeUtils::SendEventParam1(UObject* WorldContextObject, const FString EventName, const bool bPinned, const int32& ParamData)
+void UGameEventNodeUtils::SendEventParam1(UObject* WorldContextObject, const FString EventName, const bool bPinned, const bool bQueued, const int32& ParamData)
 {
 	checkNoEntry();
 }
@@ -270,16 +270,18 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam1)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 1);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
-void UGameEventNodeUtils::SendEventParam2(UObject* WorldContextObject, const FString EventName, const bool bPinned, const int32& ParamData, const int32& ParamData1)
+void UGameEventNodeUtils::SendEventParam2(UObject* WorldContextObject, const FString EventName, const bool bPinned, const bool bQueued, const int32& ParamData, const int32& ParamData1)
 {
 	checkNoEntry();
 }
@@ -292,16 +294,18 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam2)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 2);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
-void UGameEventNodeUtils::SendEventParam3(UObject* WorldContextObject, const FString EventName, const bool bPinned, const int32& ParamData, const int32& ParamData1, const int32& ParamData2)
+void UGameEventNodeUtils::SendEventParam3(UObject* WorldContextObject, const FString EventName, const bool bPinned, const bool bQueued, const int32& ParamData, const int32& ParamData1, const int32& ParamData2)
 {
 	checkNoEntry();
 }
@@ -314,16 +318,18 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam3)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 3);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
-void UGameEventNodeUtils::SendEventParam4(UObject* WorldContextObject, const FString EventName, const bool bPinned, const int32& ParamData, const int32& ParamData1, const int32& ParamData2, const int32& ParamData3)
+void UGameEventNodeUtils::SendEventParam4(UObject* WorldContextObject, const FString EventName, const bool bPinned, const bool bQueued, const int32& ParamData, const int32& ParamData1, const int32& ParamData2, const int32& ParamData3)
 {
 	checkNoEntry();
 }
@@ -336,16 +342,18 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam4)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 4);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
-void UGameEventNodeUtils::SendEventParam5(UObject* WorldContextObject, const FString EventName, const bool bPinned, const int32& ParamData, const int32& ParamData1, const int32& ParamData2, const int32& ParamData3, const int32& ParamData4)
+void UGameEventNodeUtils::SendEventParam5(UObject* WorldContextObject, const FString EventName, const bool bPinned, const bool bQueued, const int32& ParamData, const int32& ParamData1, const int32& ParamData2, const int32& ParamData3, const int32& ParamData4)
 {
 	checkNoEntry();
 }
@@ -358,18 +366,21 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam5)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 5);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
 void UGameEventNodeUtils::SendEventParam6(UObject* WorldContextObject,
                                             const FString EventName,
                                             const bool bPinned,
+                                            const bool bQueued,
                                             const int32& ParamData,
                                             const int32& ParamData1,
                                             const int32& ParamData2,
@@ -388,18 +399,21 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam6)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 6);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
 void UGameEventNodeUtils::SendEventParam7(UObject* WorldContextObject,
                                               const FString EventName,
                                               const bool bPinned,
+                                              const bool bQueued,
                                               const int32& ParamData,
                                               const int32& ParamData1,
                                               const int32& ParamData2,
@@ -419,18 +433,21 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam7)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 7);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
 void UGameEventNodeUtils::SendEventParam8(UObject* WorldContextObject,
                                               const FString EventName,
                                               const bool bPinned,
+                                              const bool bQueued,
                                               const int32& ParamData,
                                               const int32& ParamData1,
                                               const int32& ParamData2,
@@ -451,12 +468,14 @@ DEFINE_FUNCTION(UGameEventNodeUtils::execSendEventParam8)
 	Stack.StepCompiledIn<FObjectProperty>(&EventContext.WorldContext);
 	Stack.StepCompiledIn<FProperty>(&EventContext.EventId.Key);
 	Stack.StepCompiledIn<FBoolProperty>(&EventContext.bPinned);
+	bool bQueued = false;
+	Stack.StepCompiledIn<FBoolProperty>(&bQueued);
 
 	ProcessEventParameters(Stack, EventContext, 8);
 
 	P_FINISH;
 	P_NATIVE_BEGIN;
-		FGameEventManager::Get()->SendEvent(EventContext);
+		DispatchEvent(EventContext, bQueued);
 	P_NATIVE_END;
 }
 
@@ -476,18 +495,33 @@ void UGameEventNodeUtils::ProcessEventParameters(FFrame& Stack, FEventContext& E
 	}
 }
 
-void UGameEventNodeUtils::SendEvent_NoParam(UObject* WorldContextObject, const FString EventName, const bool bPinned)
+void UGameEventNodeUtils::DispatchEvent(const FEventContext& EventContext, const bool bQueued)
 {
-	if (!IsValid(WorldContextObject) || EventName.IsEmpty())
+	const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(EventContext.WorldContext);
+	if (!Manager.IsValid())
 	{
 		return;
 	}
-	const FEventContextBase EventContext(EventName, WorldContextObject, bPinned);
 
-	if (FGameEventManager::Get().IsValid())
+	if (bQueued)
+	{
+		Manager->QueueEvent(EventContext);
+	}
+	else
+	{
+		Manager->SendEvent(EventContext);
+	}
+}
+
+void UGameEventNodeUtils::SendEvent_NoParam(UObject* WorldContextObject, const FString EventName, const bool bPinned, const bool bQueued)
+{
+	if (!IsValid(WorldContextObject) || EventName.IsEmpty())
 	{
-		FGameEventManager::Get()->SendEvent(EventContext);
+		return;
 	}
+	const FEventContextBase EventContext(EventName, WorldContextObject, bPinned);
+
+	DispatchEvent(EventContext, bQueued);
 }
 
 void UGameEventNodeUtils::UnpinEvent(UObject* WorldContextObject, const FString EventName)
@@ -497,9 +531,9 @@ void UGameEventNodeUtils::UnpinEvent(UObject* WorldContextObject, const FString
 		return;
 	}
 
-	if (FGameEventManager::Get().IsValid())
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(WorldContextObject))
 	{
-		FGameEventManager::Get()->UnpinEvent(FEventId(EventName));
+		Manager->UnpinEvent(FEventId(EventName));
 	}
 }
 
@@ -510,9 +544,9 @@ bool UGameEventNodeUtils::HasEvent(UObject* WorldContextObject, const FString Ev
 		return false;
 	}
 
-	if (FGameEventManager::Get().IsValid())
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(WorldContextObject))
 	{
-		return FGameEventManager::Get()->HasEvent(FEventId(EventName));
+		return Manager->HasEvent(FEventId(EventName));
 	}
 
 	return false;
@@ -525,9 +559,9 @@ int32 UGameEventNodeUtils::GetEventListenerCount(UObject* WorldContextObject, co
 		return 0;
 	}
 
-	if (FGameEventManager::Get().IsValid())
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(WorldContextObject))
 	{
-		return FGameEventManager::Get()->GetEventListenerCount(FEventId(EventName));
+		return Manager->GetEventListenerCount(FEventId(EventName));
 	}
 
 	return 0;
@@ -540,9 +574,9 @@ void UGameEventNodeUtils::RemoveAllListenersForReceiver(UObject* Receiver)
 		return;
 	}
 
-	if (FGameEventManager::Get().IsValid())
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get(Receiver))
 	{
-		FGameEventManager::Get()->RemoveAllListenersForReceiver(Receiver);
+		Manager->RemoveAllListenersForReceiver(Receiver);
 	}
 }
 
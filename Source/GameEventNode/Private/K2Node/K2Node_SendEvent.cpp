@@ -16,10 +16,12 @@
 struct FK2Node_SendEventPinName
 {
 	static const FName PinnedName;
+	static const FName QueuedName;
 	static const FName ParamDataName;
 };
 
 const FName FK2Node_SendEventPinName::PinnedName(TEXT("Pinned"));
+const FName FK2Node_SendEventPinName::QueuedName(TEXT("Queued"));
 const FName FK2Node_SendEventPinName::ParamDataName(TEXT("ParamData"));
 
 void UK2Node_SendEvent::AllocateDefaultPins()
@@ -40,6 +42,10 @@ void UK2Node_SendEvent::AllocateDefaultPins()
 	// Pinned Pin
 	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Boolean, FK2Node_SendEventPinName::PinnedName);
 
+	// Queued Pin
+	UEdGraphPin* QueuedPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Boolean, FK2Node_SendEventPinName::QueuedName);
+	QueuedPin->PinToolTip = NSLOCTEXT("GameEventNode", "Queued_Tooltip", "Deliver the event at the next queue flush instead of immediately").ToString();
+
 	CreateEventIdentifierPins(1);
 }
 
@@ -192,11 +198,13 @@ void UK2Node_SendEvent::ExpandNode(FKismetCompilerContext& CompilerContext, UEdG
 	static const FName WorldContextObjectParamName(TEXT("WorldContextObject"));
 	static const FName EventNameParamName(TEXT("EventName"));
 	static const FName PinnedParamName(TEXT("bPinned"));
+	static const FName QueuedParamName(TEXT("bQueued"));
 
 	UEdGraphPin* ExecPin = GetExecPin();
 	UEdGraphPin* ThenPin = GetThenPin();
 	UEdGraphPin* SelfPin = GetSelfPin();
 	UEdGraphPin* PinnedPin = GetPinnedPin();
+	UEdGraphPin* QueuedPin = GetQueuedPin();
 
 	if (!ExecPin || !ThenPin || !SelfPin)
 	{
@@ -268,6 +276,10 @@ void UK2Node_SendEvent::ExpandNode(FKismetCompilerContext& CompilerContext, UEdG
 
 		CompilerContext.MovePinLinksToIntermediate(*SelfPin, *WorldContextObjectParam);
 		CompilerContext.MovePinLinksToIntermediate(*PinnedPin, *PinnedParam);
+		if (QueuedPin)
+		{
+			CompilerContext.MovePinLinksToIntermediate(*QueuedPin, *CallFuncNode->FindPinChecked(QueuedParamName));
+		}
 
 		if (bHasParam)
 		{
@@ -588,6 +600,13 @@ UEdGraphPin* UK2Node_SendEvent::GetPinnedPin() const
 	return Pin;
 }
 
+UEdGraphPin* UK2Node_SendEvent::GetQueuedPin() const
+{
+	UEdGraphPin* Pin = FindPin(FK2Node_SendEventPinName::QueuedName);
+	check(Pin == nullptr || Pin->Direction == EGPD_Input);
+	return Pin;
+}
+
 UEdGraphPin* UK2Node_SendEvent::GetParamDataPin() const
 {
 	UEdGraphPin* Pin = FindPin(FK2Node_SendEventPinName::ParamDataName);
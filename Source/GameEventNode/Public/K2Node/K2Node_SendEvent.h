@@ -32,6 +32,7 @@ private:
 #pragma region "GetPin"
 	UEdGraphPin* GetSelfPin() const;
 	UEdGraphPin* GetPinnedPin() const;
+	UEdGraphPin* GetQueuedPin() const;
 	UEdGraphPin* GetParamDataPin() const;
 #pragma endregion
 
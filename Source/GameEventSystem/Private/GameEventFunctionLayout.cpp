@@ -0,0 +1,133 @@
+#include "GameEventFunctionLayout.h"
+#include "GameEventManager.h"
+#include "GameEventTypes.h"
+#include "Hash/CityHash.h"
+#include "UObject/UnrealType.h"
+
+namespace GameEventFunctionLayout
+{
+	uint64 Combine(const uint64 Hash, const uint64 Value)
+	{
+		return CityHash128to64({Hash, Value});
+	}
+
+	uint64 Combine(const uint64 Hash, const void* Pointer)
+	{
+		return Combine(Hash, static_cast<uint64>(reinterpret_cast<UPTRINT>(Pointer)));
+	}
+}
+
+TSharedPtr<const FGameEventFunctionLayout, ESPMode::ThreadSafe> FGameEventFunctionLayout::Create(const UFunction* Function)
+{
+	if (!Function)
+	{
+		return nullptr;
+	}
+
+	const TSharedRef<FGameEventFunctionLayout, ESPMode::ThreadSafe> Layout = MakeShared<FGameEventFunctionLayout, ESPMode::ThreadSafe>();
+	Layout->ParmsSize = Function->ParmsSize;
+	Layout->MinAlignment = FMath::Max(Function->GetMinAlignment(), 1);
+
+	FGameEventManager::GetFunctionParameters(Function, Layout->Params);
+
+	uint64 Fingerprint = Layout->Params.Num();
+	for (const FProperty* Param : Layout->Params)
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, GetPropertyTypeFingerprint(Param));
+	}
+	Layout->SignatureFingerprint = Fingerprint;
+
+	bool bHasWritableParams = false;
+	for (TFieldIterator<FProperty> PropIt(Function); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+	{
+		// Const references carry CPF_OutParm as well but cannot be written through
+		bHasWritableParams |= PropIt->HasAnyPropertyFlags(CPF_OutParm) && !PropIt->HasAnyPropertyFlags(CPF_ConstParm);
+
+		if (!PropIt->HasAnyPropertyFlags(CPF_NoDestructor | CPF_IsPlainOldData))
+		{
+			Layout->DestructParams.Add(*PropIt);
+			Layout->DestructOffsets.Add(PropIt->GetOffset_ForUFunction());
+		}
+	}
+	// Script functions treat their by-value parameters as locals of the frame and may assign to them, so only native
+	// functions, whose thunks copy the parameters out of the frame, can share one
+	Layout->bCanShareFrame = Function->HasAnyFunctionFlags(FUNC_Native) && !bHasWritableParams && Layout->ParmsSize > 0;
+
+	Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, static_cast<uint64>(Layout->ParmsSize));
+	for (const FProperty* Param : Layout->Params)
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, static_cast<uint64>(Param->GetOffset_ForUFunction()));
+	}
+	Layout->FrameFingerprint = Fingerprint;
+
+	return Layout;
+}
+
+uint64 FGameEventFunctionLayout::GetPayloadFingerprint(const TArray<FPropertyContext>& PropertyContexts)
+{
+	uint64 Fingerprint = PropertyContexts.Num();
+	for (const FPropertyContext& Context : PropertyContexts)
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, GetPropertyTypeFingerprint(Context.Property.Get()));
+	}
+	return Fingerprint;
+}
+
+bool FGameEventFunctionLayout::Accepts(const UFunction* Function, const TArray<FPropertyContext>& PropertyContexts, const uint64 PayloadFingerprint) const
+{
+	if (PayloadFingerprint == SignatureFingerprint || PayloadFingerprint == AcceptedFingerprint.load(std::memory_order_relaxed))
+	{
+		return true;
+	}
+
+	if (!FGameEventManager::ValidateFunctionParameters(Function, PropertyContexts))
+	{
+		return false;
+	}
+
+	AcceptedFingerprint.store(PayloadFingerprint, std::memory_order_relaxed);
+	return true;
+}
+
+uint64 FGameEventFunctionLayout::GetPropertyTypeFingerprint(const FProperty* Property)
+{
+	if (!Property)
+	{
+		return 0;
+	}
+
+	uint64 Fingerprint = GameEventFunctionLayout::Combine(0, Property->GetClass());
+
+	// Mirror what IsParameterCompatible inspects so equal fingerprints always mean equal types
+	if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Property))
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, ObjectProp->PropertyClass);
+	}
+	else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, StructProp->Struct);
+	}
+	else if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, EnumProp->GetEnum());
+	}
+	else if (const FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, ByteProp->Enum);
+	}
+	else if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, GetPropertyTypeFingerprint(ArrayProp->Inner));
+	}
+	else if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, GetPropertyTypeFingerprint(SetProp->ElementProp));
+	}
+	else if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, GetPropertyTypeFingerprint(MapProp->KeyProp));
+		Fingerprint = GameEventFunctionLayout::Combine(Fingerprint, GetPropertyTypeFingerprint(MapProp->ValueProp));
+	}
+
+	return Fingerprint;
+}
@@ -0,0 +1,131 @@
+#include "GameEventIdRegistry.h"
+#include "GameEventTypes.h"
+#include "Logger.h"
+
+FGameEventIdRegistry& FGameEventIdRegistry::Get()
+{
+	static FGameEventIdRegistry Registry;
+	return Registry;
+}
+
+FGameEventIdRegistry::FGameEventIdRegistry()
+{
+	// Reserve slot 0 for the invalid handle
+	Names.Add(NAME_None);
+}
+
+FGameEventHandle FGameEventIdRegistry::FindOrAdd(FStringView EventName)
+{
+	if (EventName.IsEmpty())
+	{
+		return FGameEventHandle();
+	}
+
+	return FindOrAddName(FName(EventName.Len(), EventName.GetData(), FNAME_Add));
+}
+
+FGameEventHandle FGameEventIdRegistry::Find(FStringView EventName) const
+{
+	if (EventName.IsEmpty())
+	{
+		return FGameEventHandle();
+	}
+
+	// FNAME_Find only hashes the characters, an unknown name can never have been registered as an event
+	const FName Name(EventName.Len(), EventName.GetData(), FNAME_Find);
+	if (Name.IsNone())
+	{
+		return FGameEventHandle();
+	}
+
+	FReadScopeLock ReadLock(Lock);
+	if (const uint32* Id = NameToId.Find(Name))
+	{
+		return FGameEventHandle(*Id);
+	}
+	return FGameEventHandle();
+}
+
+FGameEventHandle FGameEventIdRegistry::FindOrAddTag(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid())
+	{
+		return FGameEventHandle();
+	}
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const uint32* Id = TagToId.Find(Tag))
+		{
+			return FGameEventHandle(*Id);
+		}
+	}
+
+	const FString EventName = FEventId::TagToEventName(Tag);
+	const FGameEventHandle Handle = FindOrAdd(EventName);
+
+	FWriteScopeLock WriteLock(Lock);
+	TagToId.Add(Tag, Handle.Id);
+	return Handle;
+}
+
+FGameEventHandle FGameEventIdRegistry::FindTag(const FGameplayTag& Tag) const
+{
+	if (!Tag.IsValid())
+	{
+		return FGameEventHandle();
+	}
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const uint32* Id = TagToId.Find(Tag))
+		{
+			return FGameEventHandle(*Id);
+		}
+	}
+
+	// The event name may have been interned from a string, the conversion only runs for tags not interned as tags
+	return Find(FEventId::TagToEventName(Tag));
+}
+
+FGameEventHandle FGameEventIdRegistry::FindOrAddName(const FName EventName)
+{
+	if (EventName.IsNone())
+	{
+		return FGameEventHandle();
+	}
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const uint32* Id = NameToId.Find(EventName))
+		{
+			return FGameEventHandle(*Id);
+		}
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// Another thread may have interned the name between the two locks
+	if (const uint32* Id = NameToId.Find(EventName))
+	{
+		return FGameEventHandle(*Id);
+	}
+
+	const uint32 NewId = static_cast<uint32>(Names.Add(EventName));
+	NameToId.Add(EventName, NewId);
+
+	GES_LOG_VERY_VERBOSE(TEXT("Event[%s] - Interned as handle %u"), *EventName.ToString(), NewId);
+	return FGameEventHandle(NewId);
+}
+
+FName FGameEventIdRegistry::GetName(const FGameEventHandle Handle) const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Names.IsValidIndex(Handle.Id) ? Names[Handle.Id] : NAME_None;
+}
+
+int32 FGameEventIdRegistry::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Names.Num() - 1;
+}
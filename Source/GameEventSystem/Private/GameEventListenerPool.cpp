@@ -0,0 +1,127 @@
+#include "GameEventListenerPool.h"
+#include "Logger.h"
+#include <atomic>
+
+FGameEventListenerPool::FGameEventListenerPool(const uint32 InPoolIndex, const uint32 InOwnerId) : PoolIndex(InPoolIndex),
+                                                                                                   OwnerId(InOwnerId),
+                                                                                                   FirstFree(INDEX_NONE),
+                                                                           NumLive(0),
+                                                                           NumRetired(0)
+{
+	check(InPoolIndex < FGameEventListenerHandle::MaxPools);
+}
+
+uint32 FGameEventListenerPool::NewOwnerId()
+{
+	// Wrapping takes 4 billion buses, 0 is skipped so an owned handle is never the default one
+	static std::atomic<uint32> NextOwnerId(1);
+	uint32 OwnerId = NextOwnerId.fetch_add(1, std::memory_order_relaxed);
+	while (OwnerId == 0)
+	{
+		OwnerId = NextOwnerId.fetch_add(1, std::memory_order_relaxed);
+	}
+	return OwnerId;
+}
+
+FGameEventListenerHandle FGameEventListenerPool::Add(const FListenerContext& Listener, const FGameEventHandle EventHandle, const FGameEventListenerKey& Key)
+{
+	int32 SlotIndex = FirstFree;
+	if (SlotIndex != INDEX_NONE)
+	{
+		FirstFree = Slots[SlotIndex].NextFree;
+	}
+	else
+	{
+		if (Slots.Num() >= static_cast<int32>(FGameEventListenerHandle::MaxSlots))
+		{
+			GES_LOG_ERROR(TEXT("GameEventListenerPool:Add, Pool %u is full (%d listeners)"), PoolIndex, Slots.Num());
+			return FGameEventListenerHandle();
+		}
+		SlotIndex = Slots.AddDefaulted();
+	}
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.Entry.Listener = MakeShared<const FListenerContext, ESPMode::ThreadSafe>(Listener);
+	Slot.Entry.EventHandle = EventHandle;
+	Slot.Entry.Key = Key;
+	Slot.Entry.ReceiverKey = FObjectKey(Listener.Receiver.Get());
+	Slot.NextFree = INDEX_NONE;
+	Slot.bLive = true;
+	++NumLive;
+
+	return FGameEventListenerHandle(OwnerId, PoolIndex, static_cast<uint32>(SlotIndex), Slot.Generation);
+}
+
+bool FGameEventListenerPool::Remove(const FGameEventListenerHandle ListenerHandle)
+{
+	if (!FindSlot(ListenerHandle))
+	{
+		return false;
+	}
+
+	const int32 SlotIndex = static_cast<int32>(ListenerHandle.GetSlot());
+	FSlot& Slot = Slots[SlotIndex];
+
+	// Drop the pool's reference now rather than when the slot is reused, snapshots still dispatching keep the record alive
+	Slot.Entry = FEntry();
+	Slot.bLive = false;
+	ReleaseSlot(SlotIndex);
+	--NumLive;
+	return true;
+}
+
+const FGameEventListenerPool::FEntry* FGameEventListenerPool::Find(const FGameEventListenerHandle ListenerHandle) const
+{
+	const FSlot* Slot = FindSlot(ListenerHandle);
+	return Slot ? &Slot->Entry : nullptr;
+}
+
+void FGameEventListenerPool::Empty()
+{
+	// Slots are kept with their generations bumped, so handles issued before the reset never resolve again
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		if (Slot.bLive)
+		{
+			Slot.Entry = FEntry();
+			Slot.bLive = false;
+			ReleaseSlot(SlotIndex);
+		}
+	}
+	NumLive = 0;
+}
+
+void FGameEventListenerPool::ReleaseSlot(const int32 SlotIndex)
+{
+	FSlot& Slot = Slots[SlotIndex];
+	if (Slot.Generation == FGameEventListenerHandle::MaxGeneration)
+	{
+		// The next generation would wrap to one that handles still around may carry, the slot is never reused
+		Slot.Generation = 0;
+		++NumRetired;
+		GES_LOG_VERY_VERBOSE(TEXT("GameEventListenerPool:ReleaseSlot, Pool %u retired slot %d, %d retired"), PoolIndex, SlotIndex, NumRetired);
+		return;
+	}
+
+	++Slot.Generation;
+	Slot.NextFree = FirstFree;
+	FirstFree = SlotIndex;
+}
+
+const FGameEventListenerPool::FSlot* FGameEventListenerPool::FindSlot(const FGameEventListenerHandle ListenerHandle) const
+{
+	if (!ListenerHandle.IsValid() || ListenerHandle.GetOwner() != OwnerId || ListenerHandle.GetPool() != PoolIndex)
+	{
+		return nullptr;
+	}
+
+	const int32 SlotIndex = static_cast<int32>(ListenerHandle.GetSlot());
+	if (!Slots.IsValidIndex(SlotIndex))
+	{
+		return nullptr;
+	}
+
+	const FSlot& Slot = Slots[SlotIndex];
+	return Slot.bLive && Slot.Generation == ListenerHandle.GetGeneration() ? &Slot : nullptr;
+}
@@ -0,0 +1,515 @@
+#include "GameEventLocalBus.h"
+#include "Algo/BinarySearch.h"
+#include "GameEventManager.h"
+#include "Logger.h"
+
+FGameEventLocalBus::FGameEventLocalBus(UObject* InOwner) : Owner(InOwner),
+                                                          LambdaListenerIdCounter(1), // Start from 1 to ensure ID is never 0
+                                                          bBubble(false)
+{
+}
+
+FGameEventLocalBus::~FGameEventLocalBus()
+{
+	Clear();
+}
+
+void FGameEventLocalBus::SetOwner(UObject* InOwner)
+{
+	Owner = InOwner;
+
+	// The owner may belong to another world now, resolve the parent bus again on next use.
+	// Pinned payloads are copied by the old parent, keep it alive while they exist
+	if (Events.Num() == 0)
+	{
+		ParentBus.Reset();
+	}
+}
+
+void FGameEventLocalBus::Clear()
+{
+	Events.Empty();
+	Listeners.Empty();
+}
+
+#pragma region  "Listener"
+
+FGameEventListenerHandle FGameEventLocalBus::AddListener(const FEventId& EventId, const FListenerContext& Listener)
+{
+	check(IsInGameThread());
+
+	if (!EventId.IsValid())
+	{
+		GES_LOG_ERROR(TEXT("LocalEvent[%s] - Cannot add listener - EventId is invalid"), *EventId.GetName());
+		return FGameEventListenerHandle();
+	}
+
+	if (!Listener.Receiver.IsValid())
+	{
+		GES_LOG_ERROR(TEXT("LocalEvent[%s] - Cannot add listener - Receiver object is invalid"), *EventId.GetName());
+		return FGameEventListenerHandle();
+	}
+
+	FListenerContext NewListener = Listener;
+	if (!NewListener.IsBoundToDelegate() && !NewListener.IsBoundToLambda() && !NewListener.LinkFunction())
+	{
+		GES_LOG_ERROR(TEXT("LocalEvent[%s] - Listener registration failed - Cannot link function: %s"),
+		              *EventId.GetName(),
+		              *NewListener.ToString());
+		return FGameEventListenerHandle();
+	}
+
+	if (!NewListener.PrepareExecution())
+	{
+		GES_LOG_ERROR(TEXT("LocalEvent[%s] - Listener registration failed - Only lambda listeners run off the game thread, and pipe listeners need a pipe name: %s"),
+		              *EventId.GetName(),
+		              *NewListener.ToString());
+		return FGameEventListenerHandle();
+	}
+
+	const FGameEventHandle EventHandle = EventId.FindOrAddHandle();
+	const int32 EventIndex = FindOrAddEvent(EventHandle);
+
+	const FGameEventListenerKey ListenerKey = NewListener.GetKey();
+	for (const FGameEventListenerHandle ExistingHandle : Events[EventIndex].Listeners)
+	{
+		const FGameEventListenerPool::FEntry* Entry = Listeners.Find(ExistingHandle);
+		if (Entry && Entry->Key == ListenerKey)
+		{
+			GES_LOG_WARNING(TEXT("LocalEvent[%s] - Listener already exists, skipping duplicate registration: %s"),
+			                *EventId.GetName(),
+			                *NewListener.ToString());
+			return FGameEventListenerHandle();
+		}
+	}
+
+	const FGameEventListenerHandle ListenerHandle = Listeners.Add(NewListener, EventHandle, ListenerKey);
+	if (!ListenerHandle.IsValid())
+	{
+		RemoveEventIfUnused(EventIndex);
+		return FGameEventListenerHandle();
+	}
+
+	// Insert at the end of the listener's priority bucket, Listeners stays sorted by descending priority
+	FLocalEvent& Event = Events[EventIndex];
+	const int32 Position = Algo::UpperBoundBy(Event.Listeners,
+	                                          NewListener.Priority,
+	                                          [this](const FGameEventListenerHandle Handle)
+	                                          {
+		                                          const FGameEventListenerPool::FEntry* Entry = Listeners.Find(Handle);
+		                                          return Entry ? Entry->Listener->Priority : MIN_int32;
+	                                          },
+	                                          TGreater<int32>());
+	Event.Listeners.Insert(ListenerHandle, Position);
+	Event.Snapshot.Reset();
+
+	GES_LOG_DISPLAY(TEXT("LocalEvent[%s] - Listener registered successfully -> %s"), *EventId.GetName(), *NewListener.ToString());
+
+	// Late listeners of a pinned event get the stored payload right away
+	if (Event.bPinned)
+	{
+		FEventContext PinnedContext;
+		PinnedContext.EventId = EventId;
+		PinnedContext.WorldContext = Owner.Get();
+		PinnedContext.bPinned = true;
+
+		// Keep a reference, the listener may unpin or resend while it runs
+		const FGameEventPinnedPayloadRef PinnedPayload = Event.PinnedPayload;
+		FGameEventManager::FAsyncDispatch AsyncDispatch;
+		if (PinnedPayload.IsValid())
+		{
+			PinnedContext.PropertyContexts = PinnedPayload->GetPropertyContexts();
+			AsyncDispatch.Payload = PinnedPayload;
+		}
+
+		const FListenerRecord Record = Listeners.Find(ListenerHandle)->Listener.ToSharedRef();
+		GetParentBus().DispatchToListeners(MakeArrayView(&Record, 1), PinnedContext, nullptr, &AsyncDispatch);
+	}
+
+	return ListenerHandle;
+}
+
+FGameEventListenerHandle FGameEventLocalBus::AddListenerFunction(const FEventId& EventId,
+                                                                UObject* Receiver,
+                                                                const FString& FunctionName,
+                                                                const FGameEventTagFilter& TagFilter,
+                                                                const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+                                                                const int32 Priority)
+{
+	if (!Receiver || FunctionName.IsEmpty())
+	{
+		GES_LOG_WARNING(TEXT("LocalEvent[%s] - AddListenerFunction Failed"), *EventId.GetName());
+		return FGameEventListenerHandle();
+	}
+
+	FListenerContext Listener;
+	Listener.Receiver = Receiver;
+	Listener.FunctionName = FunctionName;
+	Listener.SetTagFilter(TagFilter);
+	Listener.SetPayloadPredicates(PayloadPredicates);
+	Listener.Priority = Priority;
+
+	if (Listener.LinkFunction())
+	{
+		return AddListener(EventId, Listener);
+	}
+
+	GES_LOG_WARNING(TEXT("LocalEvent[%s] Failed to find function '%s' in object '%s'"),
+	                *EventId.GetName(),
+	                *FunctionName,
+	                *Receiver->GetClass()->GetName());
+	return FGameEventListenerHandle();
+}
+
+void FGameEventLocalBus::RemoveListener(const FEventId& EventId, const FListenerContext& Listener)
+{
+	check(IsInGameThread());
+
+	const int32 EventIndex = FindEvent(EventId.GetHandle());
+	if (EventIndex == INDEX_NONE)
+	{
+		GES_LOG_WARNING(TEXT("LocalEvent[%s] - Attempting to remove listener from non-existent event"), *EventId.GetName());
+		return;
+	}
+
+	const FGameEventListenerKey ListenerKey = Listener.GetKey();
+	const TArray<FGameEventListenerHandle>& EventListeners = Events[EventIndex].Listeners;
+	for (int32 ListenerIndex = 0; ListenerIndex < EventListeners.Num(); ++ListenerIndex)
+	{
+		const FGameEventListenerPool::FEntry* Entry = Listeners.Find(EventListeners[ListenerIndex]);
+		if (Entry && Entry->Key == ListenerKey)
+		{
+			RemoveListenerAt(EventIndex, ListenerIndex);
+			GES_LOG_DISPLAY(TEXT("LocalEvent[%s] Listener removed successfully -> %s"), *EventId.GetName(), *Listener.ToString());
+			return;
+		}
+	}
+
+	GES_LOG_WARNING(TEXT("LocalEvent[%s] - Listener to remove not found in [%s]"), *EventId.GetName(), *Listener.ToString());
+}
+
+void FGameEventLocalBus::RemoveListener(const FEventId& EventId, UObject* Receiver, const FString& FunctionName)
+{
+	if (!Receiver || FunctionName.IsEmpty())
+	{
+		GES_LOG_WARNING(TEXT("LocalEvent[%s] - Invalid receiver or function name"), *EventId.GetName());
+		return;
+	}
+
+	FListenerContext Listener;
+	Listener.Receiver = Receiver;
+	Listener.FunctionName = FunctionName;
+	Listener.LinkFunction();
+
+	RemoveListener(EventId, Listener);
+}
+
+void FGameEventLocalBus::RemoveListener(const FGameEventListenerHandle ListenerHandle)
+{
+	check(IsInGameThread());
+
+	const FGameEventListenerPool::FEntry* Entry = Listeners.Find(ListenerHandle);
+	if (!Entry)
+	{
+		return;
+	}
+
+	const int32 EventIndex = FindEvent(Entry->EventHandle);
+	if (EventIndex == INDEX_NONE)
+	{
+		Listeners.Remove(ListenerHandle);
+		return;
+	}
+
+	const int32 ListenerIndex = Events[EventIndex].Listeners.Find(ListenerHandle);
+	if (ListenerIndex != INDEX_NONE)
+	{
+		RemoveListenerAt(EventIndex, ListenerIndex);
+	}
+	else
+	{
+		Listeners.Remove(ListenerHandle);
+	}
+}
+
+void FGameEventLocalBus::RemoveAllListenersForReceiver(const UObject* Receiver)
+{
+	check(IsInGameThread());
+
+	if (!Receiver)
+	{
+		return;
+	}
+
+	const FObjectKey ReceiverKey(Receiver);
+	int32 RemovedCount = 0;
+
+	// Backwards, removing an event swaps the last one into its place
+	for (int32 EventIndex = Events.Num() - 1; EventIndex >= 0; --EventIndex)
+	{
+		for (int32 ListenerIndex = Events[EventIndex].Listeners.Num() - 1; ListenerIndex >= 0; --ListenerIndex)
+		{
+			const FGameEventListenerPool::FEntry* Entry = Listeners.Find(Events[EventIndex].Listeners[ListenerIndex]);
+			if (Entry && Entry->ReceiverKey == ReceiverKey)
+			{
+				++RemovedCount;
+				if (RemoveListenerAt(EventIndex, ListenerIndex))
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	GES_LOG_DISPLAY(TEXT("GameEventLocalBus:RemoveAllListenersForReceiver, Removed %d listeners for receiver[%s]"), RemovedCount, *Receiver->GetName());
+}
+
+#pragma endregion  "Listener"
+
+#pragma region  "Send"
+
+bool FGameEventLocalBus::SendEvent(const FEventContext& EventContext)
+{
+	check(IsInGameThread());
+
+	if (!EventContext.EventId.IsValid())
+	{
+		return false;
+	}
+
+	// A name nobody interned has no local listeners, only a pin has to keep it
+	const FGameEventHandle EventHandle = EventContext.bPinned ? EventContext.EventId.FindOrAddHandle() : EventContext.EventId.GetHandle();
+	FGameEventManager& Parent = GetParentBus();
+
+	int32 EventIndex = FindEvent(EventHandle);
+	if (EventContext.bPinned)
+	{
+		if (EventIndex == INDEX_NONE)
+		{
+			EventIndex = FindOrAddEvent(EventHandle);
+		}
+
+		// Late listeners read a copy, never the sender's stack or VM frame
+		FLocalEvent& Event = Events[EventIndex];
+		Event.bPinned = true;
+		if (EventContext.HasValidParameters())
+		{
+			Event.PinnedPayload = Parent.PinnedPayloadStore.Copy(EventContext.PropertyContexts);
+		}
+		else
+		{
+			Event.PinnedPayload.SafeRelease();
+		}
+	}
+
+	// Listeners may add or remove listeners of this bus while the snapshot is dispatched
+	const FListenerSnapshot Snapshot = EventIndex != INDEX_NONE ? GetSnapshot(Events[EventIndex]) : nullptr;
+	if (Snapshot.IsValid() && Snapshot->Listeners.Num() > 0)
+	{
+		if (Parent.DispatchToListeners(*Snapshot, EventContext) > 0)
+		{
+			RemoveDeadListeners(EventHandle);
+		}
+	}
+	else if (!bBubble)
+	{
+		GES_LOG_VERY_VERBOSE(TEXT("LocalEvent[%s] - No listeners registered"), *EventContext.EventId.GetName());
+	}
+
+	// The typed payload still points at the sender's stack, the parent bus dispatches before this returns
+	if (bBubble)
+	{
+		// The pin belongs to this bus, UnpinEvent here could never clear a copy pinned on the parent
+		if (EventContext.bPinned)
+		{
+			FEventContext BubbledContext = EventContext;
+			BubbledContext.bPinned = false;
+			return Parent.SendEvent(BubbledContext);
+		}
+		return Parent.SendEvent(EventContext);
+	}
+
+	return true;
+}
+
+#pragma endregion  "Send"
+
+void FGameEventLocalBus::UnpinEvent(const FEventId& EventId)
+{
+	check(IsInGameThread());
+
+	const int32 EventIndex = FindEvent(EventId.GetHandle());
+	if (EventIndex == INDEX_NONE || !Events[EventIndex].bPinned)
+	{
+		GES_LOG_WARNING(TEXT("LocalEvent[%s] - Event is not pinned"), *EventId.GetName());
+		return;
+	}
+
+	Events[EventIndex].bPinned = false;
+	Events[EventIndex].PinnedPayload.SafeRelease();
+	RemoveEventIfUnused(EventIndex);
+
+	GES_LOG_DISPLAY(TEXT("LocalEvent[%s] - Unpinned"), *EventId.GetName());
+}
+
+bool FGameEventLocalBus::HasEvent(const FEventId& EventId) const
+{
+	return FindEvent(EventId.GetHandle()) != INDEX_NONE;
+}
+
+int32 FGameEventLocalBus::GetEventListenerCount(const FEventId& EventId) const
+{
+	const int32 EventIndex = FindEvent(EventId.GetHandle());
+	return EventIndex != INDEX_NONE ? Events[EventIndex].Listeners.Num() : 0;
+}
+
+TArray<FGameEventPriorityBucket> FGameEventLocalBus::GetEventListenerCountsByPriority(const FEventId& EventId) const
+{
+	TArray<FGameEventPriorityBucket> Buckets;
+
+	const int32 EventIndex = FindEvent(EventId.GetHandle());
+	if (EventIndex == INDEX_NONE)
+	{
+		return Buckets;
+	}
+
+	for (const FGameEventListenerHandle ListenerHandle : Events[EventIndex].Listeners)
+	{
+		const FGameEventListenerPool::FEntry* Entry = Listeners.Find(ListenerHandle);
+		const int32 Priority = Entry ? Entry->Listener->Priority : MIN_int32;
+		if (Buckets.Num() == 0 || Buckets.Last().Priority != Priority)
+		{
+			Buckets.AddDefaulted_GetRef().Priority = Priority;
+		}
+		++Buckets.Last().NumListeners;
+	}
+	return Buckets;
+}
+
+FGameEventManager& FGameEventLocalBus::GetParentBus()
+{
+	if (!ParentBus.IsValid())
+	{
+		ParentBus = FGameEventManager::Get(Owner.Get());
+	}
+	return *ParentBus;
+}
+
+int32 FGameEventLocalBus::FindEvent(const FGameEventHandle EventHandle) const
+{
+	for (int32 EventIndex = 0; EventIndex < Events.Num(); ++EventIndex)
+	{
+		if (Events[EventIndex].EventHandle == EventHandle)
+		{
+			return EventIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FGameEventLocalBus::FindOrAddEvent(const FGameEventHandle EventHandle)
+{
+	const int32 EventIndex = FindEvent(EventHandle);
+	if (EventIndex != INDEX_NONE)
+	{
+		return EventIndex;
+	}
+
+	FLocalEvent& Event = Events.AddDefaulted_GetRef();
+	Event.EventHandle = EventHandle;
+	return Events.Num() - 1;
+}
+
+void FGameEventLocalBus::RemoveEventIfUnused(const int32 EventIndex)
+{
+	if (Events[EventIndex].Listeners.Num() == 0 && !Events[EventIndex].bPinned)
+	{
+		Events.RemoveAtSwap(EventIndex);
+	}
+}
+
+FListenerSnapshot FGameEventLocalBus::GetSnapshot(FLocalEvent& Event) const
+{
+	if (!Event.Snapshot.IsValid())
+	{
+		TSharedRef<FGameEventListenerSnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FGameEventListenerSnapshot, ESPMode::ThreadSafe>();
+		NewSnapshot->Listeners.Reserve(Event.Listeners.Num());
+		for (const FGameEventListenerHandle ListenerHandle : Event.Listeners)
+		{
+			if (const FGameEventListenerPool::FEntry* Entry = Listeners.Find(ListenerHandle))
+			{
+				NewSnapshot->Listeners.Add(Entry->Listener.ToSharedRef());
+			}
+		}
+		NewSnapshot->Finalize();
+		Event.Snapshot = NewSnapshot;
+	}
+	return Event.Snapshot;
+}
+
+void FGameEventLocalBus::RemoveDeadListeners(const FGameEventHandle EventHandle)
+{
+	// Dispatch may have removed the event already
+	const int32 EventIndex = FindEvent(EventHandle);
+	if (EventIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	for (int32 ListenerIndex = Events[EventIndex].Listeners.Num() - 1; ListenerIndex >= 0; --ListenerIndex)
+	{
+		const FGameEventListenerPool::FEntry* Entry = Listeners.Find(Events[EventIndex].Listeners[ListenerIndex]);
+		if (!Entry || !Entry->Listener->Receiver.IsValid())
+		{
+			if (RemoveListenerAt(EventIndex, ListenerIndex))
+			{
+				return;
+			}
+		}
+	}
+}
+
+int32 FGameEventLocalBus::PurgeDeadReceivers()
+{
+	check(IsInGameThread());
+
+	int32 NumRemoved = 0;
+	for (int32 EventIndex = Events.Num() - 1; EventIndex >= 0; --EventIndex)
+	{
+		for (int32 ListenerIndex = Events[EventIndex].Listeners.Num() - 1; ListenerIndex >= 0; --ListenerIndex)
+		{
+			const FGameEventListenerPool::FEntry* Entry = Listeners.Find(Events[EventIndex].Listeners[ListenerIndex]);
+			if (Entry && Entry->Listener->Receiver.IsValid())
+			{
+				continue;
+			}
+
+			++NumRemoved;
+			if (RemoveListenerAt(EventIndex, ListenerIndex))
+			{
+				// The event went with its last listener
+				break;
+			}
+		}
+	}
+
+	if (NumRemoved > 0)
+	{
+		GES_LOG_VERY_VERBOSE(TEXT("GameEventLocalBus:PurgeDeadReceivers, Removed %d listeners of dead receivers from the bus of [%s]"), NumRemoved, *GetNameSafe(Owner.Get()));
+	}
+	return NumRemoved;
+}
+
+bool FGameEventLocalBus::RemoveListenerAt(const int32 EventIndex, const int32 ListenerIndex)
+{
+	FLocalEvent& Event = Events[EventIndex];
+	Listeners.Remove(Event.Listeners[ListenerIndex]);
+
+	// Dispatch order is registration order, so no swap here
+	Event.Listeners.RemoveAt(ListenerIndex);
+	Event.Snapshot.Reset();
+
+	const int32 NumEvents = Events.Num();
+	RemoveEventIfUnused(EventIndex);
+	return Events.Num() != NumEvents;
+}
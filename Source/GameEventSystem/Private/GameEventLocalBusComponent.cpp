@@ -0,0 +1,55 @@
+#include "GameEventLocalBusComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+
+UGameEventLocalBusComponent::UGameEventLocalBusComponent() : bBubbleToWorldBus(false)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UGameEventLocalBusComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	Bus.SetOwner(GetOwner());
+	Bus.SetBubbling(bBubbleToWorldBus);
+
+	// Listeners of receivers destroyed while the actor lives would otherwise stay until a send reaches them
+	if (!PostGarbageCollectDelegate.IsValid())
+	{
+		PostGarbageCollectDelegate = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UGameEventLocalBusComponent::OnPostGarbageCollect);
+	}
+}
+
+void UGameEventLocalBusComponent::OnUnregister()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectDelegate);
+	PostGarbageCollectDelegate.Reset();
+
+	Super::OnUnregister();
+}
+
+void UGameEventLocalBusComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Listener captures and pinned payloads go with the actor, not with the next garbage collection
+	Bus.Clear();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGameEventLocalBusComponent::OnPostGarbageCollect()
+{
+	Bus.PurgeDeadReceivers();
+}
+
+FGameEventLocalBus* UGameEventLocalBusComponent::FindLocalBus(const AActor* Actor)
+{
+	for (; Actor; Actor = Actor->GetOwner())
+	{
+		if (UGameEventLocalBusComponent* Component = Actor->FindComponentByClass<UGameEventLocalBusComponent>())
+		{
+			return &Component->GetBus();
+		}
+	}
+	return nullptr;
+}
@@ -1,14 +1,159 @@
 #include "GameEventManager.h"
+#include "GameEventParamsBuffer.h"
+#include "GameEventPayloadPredicate.h"
+#include "GameEventStats.h"
+#include "GameEventSystemSettings.h"
 #include "GameEventTypes.h"
+#include "GameEventWorldSubsystem.h"
 #include "Logger.h"
 #include "Engine/World.h"
 #include "UObject/UnrealType.h"
+#include "Tasks/Pipe.h"
 #include <atomic>
 
-TSharedPtr<FGameEventManager> FGameEventManager::PrivateDefaultManager = nullptr;
+namespace GameEventPipes
+{
+	struct FNamedPipe
+	{
+		explicit FNamedPipe(const FName Name) : DebugName(Name.ToString()),
+		                                        Pipe(*DebugName)
+		{
+		}
+
+		// FPipe keeps the pointer, the string lives as long as the pipe
+		FString DebugName;
+
+		UE::Tasks::FPipe Pipe;
+	};
+
+	/** Pipes are shared by every bus, listeners naming the same pipe never run concurrently */
+	static UE::Tasks::FPipe& Get(const FName PipeName)
+	{
+		static FCriticalSection CriticalSection;
+		static TMap<FName, TUniquePtr<FNamedPipe>> Pipes;
+
+		FScopeLock Lock(&CriticalSection);
+		TUniquePtr<FNamedPipe>& NamedPipe = Pipes.FindOrAdd(PipeName);
+		if (!NamedPipe.IsValid())
+		{
+			NamedPipe = MakeUnique<FNamedPipe>(PipeName);
+		}
+		return NamedPipe->Pipe;
+	}
+}
+
+#pragma region "ListenerCounts"
+
+FGameEventListenerCounts::FGameEventListenerCounts()
+{
+	for (std::atomic<std::atomic<int32>*>& Chunk : Chunks)
+	{
+		Chunk.store(nullptr, std::memory_order_relaxed);
+	}
+}
 
-FGameEventManager::FGameEventManager() : LambdaListenerIdCounter(1) // Start from 1 to ensure ID is never 0
+FGameEventListenerCounts::~FGameEventListenerCounts()
 {
+	for (std::atomic<std::atomic<int32>*>& Chunk : Chunks)
+	{
+		delete[] Chunk.exchange(nullptr);
+	}
+}
+
+bool FGameEventListenerCounts::TryGet(const FGameEventHandle Handle, int32& OutCount) const
+{
+	const uint32 ChunkIndex = Handle.Id / ChunkSize;
+	if (ChunkIndex >= MaxChunks)
+	{
+		return false;
+	}
+
+	const std::atomic<int32>* Chunk = Handle.IsValid() ? Chunks[ChunkIndex].load(std::memory_order_acquire) : nullptr;
+	OutCount = Chunk ? Chunk[Handle.Id % ChunkSize].load(std::memory_order_acquire) : INDEX_NONE;
+	return true;
+}
+
+void FGameEventListenerCounts::Set(const FGameEventHandle Handle, const int32 Count)
+{
+	const uint32 ChunkIndex = Handle.Id / ChunkSize;
+	if (!Handle.IsValid() || ChunkIndex >= MaxChunks)
+	{
+		return;
+	}
+
+	if (std::atomic<int32>* Chunk = FindOrAddChunk(ChunkIndex))
+	{
+		Chunk[Handle.Id % ChunkSize].store(Count, std::memory_order_release);
+	}
+}
+
+void FGameEventListenerCounts::Reset()
+{
+	for (std::atomic<std::atomic<int32>*>& Chunk : Chunks)
+	{
+		if (std::atomic<int32>* Counts = Chunk.load(std::memory_order_acquire))
+		{
+			for (uint32 Index = 0; Index < ChunkSize; ++Index)
+			{
+				Counts[Index].store(INDEX_NONE, std::memory_order_release);
+			}
+		}
+	}
+}
+
+std::atomic<int32>* FGameEventListenerCounts::FindOrAddChunk(const uint32 ChunkIndex)
+{
+	std::atomic<int32>* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+	if (Chunk)
+	{
+		return Chunk;
+	}
+
+	std::atomic<int32>* NewChunk = new std::atomic<int32>[ChunkSize];
+	for (uint32 Index = 0; Index < ChunkSize; ++Index)
+	{
+		NewChunk[Index].store(INDEX_NONE, std::memory_order_relaxed);
+	}
+
+	// Another writer may have installed the chunk first
+	if (!Chunks[ChunkIndex].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+	{
+		delete[] NewChunk;
+		return Chunk;
+	}
+	return NewChunk;
+}
+
+#pragma endregion "ListenerCounts"
+
+FGameEventManager::FGameEventManager() : LambdaListenerIdCounter(1), // Start from 1 to ensure ID is never 0
+                                         ThreadedSendStamp(0),
+                                         NumSendsWithNoListeners(0)
+{
+	static_assert(NumShards <= FGameEventListenerHandle::MaxPools, "Listener handles must be able to address every shard");
+
+	// The shards share one owner id, handles of another manager or of a local bus never resolve here
+	const uint32 OwnerId = FGameEventListenerPool::NewOwnerId();
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+	{
+		Shards[ShardIndex].Listeners = FGameEventListenerPool(static_cast<uint32>(ShardIndex), OwnerId);
+	}
+
+	const UGameEventSystemSettings* Settings = UGameEventSystemSettings::Get();
+	for (int32 Producer = 0; Producer < static_cast<int32>(EGameEventProducer::Count); ++Producer)
+	{
+		const FGameEventProducerQueueConfig* Config = Settings ? Settings->ProducerQueues.Find(static_cast<EGameEventProducer>(Producer)) : nullptr;
+		const FGameEventProducerQueueConfig DefaultConfig;
+		ThreadQueues[Producer] = MakeUnique<FGameEventThreadQueue>(Config ? Config->Capacity : DefaultConfig.Capacity, Config ? Config->OverflowPolicy : DefaultConfig.OverflowPolicy);
+	}
+
+	for (int32 Lane = 0; Lane < static_cast<int32>(EGameEventLane::Count); ++Lane)
+	{
+		if (const FGameEventLaneConfig* Config = Settings ? Settings->QueueLanes.Find(static_cast<EGameEventLane>(Lane)) : nullptr)
+		{
+			EventQueue.SetLaneConfig(static_cast<EGameEventLane>(Lane), *Config);
+		}
+	}
 }
 
 FGameEventManager::~FGameEventManager()
@@ -17,29 +162,66 @@ FGameEventManager::~FGameEventManager()
 
 TSharedPtr<FGameEventManager> FGameEventManager::Get()
 {
-	if (!PrivateDefaultManager.IsValid())
+	// Function-local static, initialized exactly once even when several threads ask for the bus first
+	static const TSharedPtr<FGameEventManager> GlobalManager = []()
 	{
-		PrivateDefaultManager = MakeShared<FGameEventManager>();
-		GES_LOG_DISPLAY(TEXT("GameEventManager instance created successfully, hash: 0x%08X"), GetTypeHash(PrivateDefaultManager));
-	}
+		TSharedPtr<FGameEventManager> Manager = MakeShared<FGameEventManager>();
+		GES_LOG_DISPLAY(TEXT("GameEventManager instance created successfully, hash: 0x%08X"), GetTypeHash(Manager));
+		return Manager;
+	}();
 
-	return PrivateDefaultManager;
+	return GlobalManager;
+}
+
+TSharedPtr<FGameEventManager> FGameEventManager::Get(const UObject* WorldContext)
+{
+	if (TSharedPtr<FGameEventManager> WorldManager = UGameEventWorldSubsystem::FindEventManager(WorldContext))
+	{
+		return WorldManager;
+	}
+	return Get();
 }
 
 void FGameEventManager::Clear()
 {
-	FScopeLock Lock(&CriticalSection);
+	int32 EventCount = 0;
+	int32 ListenerCount = 0;
+	for (FEventShard& Shard : Shards)
+	{
+		Shard.CriticalSection.Lock();
+		EventCount += Shard.Events.Num();
+		ListenerCount += Shard.Listeners.Num();
+		Shard.Events.Empty();
+		Shard.Listeners.Empty();
+		Shard.PinnedPayloads.Empty();
+	}
+	ListenerCounts.Reset();
+	WildcardIndex.Empty();
 
-	const int32 EventCount = EventMap.Num();
-	const int32 ReceiverCount = ReceiverMap.Num();
-	const int32 LambdaListenerCount = LambdaListenerMap.Num();
+	const int32 QueuedEventCount = EventQueue.Num();
+	EventQueue.Reset();
+	for (const TUniquePtr<FGameEventThreadQueue>& ThreadQueue : ThreadQueues)
+	{
+		ThreadQueue->Reset();
+	}
+
+	int32 ReceiverCount = 0;
+	{
+		FScopeLock ReceiverLock(&ReceiverCriticalSection);
 
-	EventMap.Empty();
-	ReceiverMap.Empty();
-	LambdaListenerMap.Empty();
-	LambdaListenerIdCounter.store(1);
+		ReceiverCount = ReceiverMap.Num();
 
-	GES_LOG_DISPLAY(TEXT("GameEventManager cleanup completed - cleared %d events, %d receivers, %d LambdaListeners"), EventCount, ReceiverCount, LambdaListenerCount);
+		ReceiverMap.Empty();
+		PendingPurge.Empty();
+		LambdaListenerIdCounter.store(1);
+	}
+
+	for (int32 ShardIndex = NumShards - 1; ShardIndex >= 0; --ShardIndex)
+	{
+		Shards[ShardIndex].CriticalSection.Unlock();
+	}
+
+	GES_LOG_DISPLAY(TEXT("GameEventManager cleanup completed - cleared %d events, %d listeners, %d receivers, %d queued events"), EventCount, ListenerCount, ReceiverCount, QueuedEventCount);
 }
 
 #pragma region "static"
@@ -208,86 +390,23 @@ bool FGameEventManager::IsParameterCompatible(const FProperty* ExpectedParam, co
 	return false;
 }
 
-void FGameEventManager::RemoveListenerFromEvent(const FEventId& EventId, const FListenerContext& Listener)
-{
-	if (!EventMap.Contains(EventId))
-	{
-		return;
-	}
-
-	FEventContext& TargetEvent = EventMap[EventId];
-
-	// Iterate backwards to safely remove elements
-	for (int32 i = TargetEvent.Listeners.Num() - 1; i >= 0; --i)
-	{
-		const FListenerContext& CurrentListener = TargetEvent.Listeners[i];
-
-		if (!CurrentListener.Receiver.IsValid())
-		{
-			TargetEvent.Listeners.RemoveAt(i);
-			continue;
-		}
-
-		if (CurrentListener == Listener)
-		{
-			TargetEvent.Listeners.RemoveAt(i);
-
-			// Update receiver mapping table
-			if (UObject* ReceiverObj = Listener.Receiver.Get())
-			{
-				if (TArray<FListener>* Contexts = ReceiverMap.Find(ReceiverObj))
-				{
-					for (int32 j = Contexts->Num() - 1; j >= 0; --j)
-					{
-						const FListener& Context = (*Contexts)[j];
-						if (Context.EventId == EventId && Context.Listener == Listener)
-						{
-							Contexts->RemoveAt(j);
-							break;
-						}
-					}
-
-					if (Contexts->Num() == 0)
-					{
-						ReceiverMap.Remove(ReceiverObj);
-					}
-				}
-			}
-			break;
-		}
-	}
-
-	// Check if event still has listeners, delete event if not
-	if (TargetEvent.Listeners.Num() == 0 && !TargetEvent.bPinned)
-	{
-		EventMap.Remove(EventId);
-	}
-}
-
 #pragma endregion "static"
 
 #pragma region  "Listener"
 
 #pragma region "Add"
-void FGameEventManager::AddListener(const FEventId& EventId, const FListenerContext& Listener)
+FGameEventListenerHandle FGameEventManager::AddListener(const FEventId& EventId, const FListenerContext& Listener)
 {
 	if (!EventId.IsValid())
 	{
 		GES_LOG_ERROR(TEXT("Event[%s] - Cannot add listener - EventId is invalid"), *EventId.GetName());
-		return;
+		return FGameEventListenerHandle();
 	}
 
 	if (!Listener.Receiver.IsValid())
 	{
 		GES_LOG_ERROR(TEXT("Event[%s] - Cannot add listener - Receiver object is invalid"), *EventId.GetName());
-		return;
-	}
-
-	FScopeLock Lock(&CriticalSection);
-
-	if (!EventMap.Contains(EventId))
-	{
-		CreateEvent(EventId);
+		return FGameEventListenerHandle();
 	}
 
 	FListenerContext NewListener = Listener;
@@ -298,174 +417,143 @@ void FGameEventManager::AddListener(const FEventId& EventId, const FListenerCont
 			GES_LOG_ERROR(TEXT("Event[%s] - Listener registration failed - Cannot link function: %s"),
 			              *EventId.GetName(),
 			              *NewListener.ToString());
-			return;
+			return FGameEventListenerHandle();
 		}
 	}
 
-	FEventContext& TargetEvent = EventMap[EventId];
+	if (!NewListener.PrepareExecution())
+	{
+		GES_LOG_ERROR(TEXT("Event[%s] - Listener registration failed - Only lambda listeners run off the game thread, and pipe listeners need a pipe name: %s"),
+		              *EventId.GetName(),
+		              *NewListener.ToString());
+		return FGameEventListenerHandle();
+	}
+
+	const FGameEventHandle EventHandle = EventId.FindOrAddHandle();
+	FEventShard& Shard = GetShard(EventHandle);
+	FScopeLock Lock(&Shard.CriticalSection);
 
-	if (TargetEvent.Listeners.Contains(NewListener))
+	const int32 EventIndex = CreateEvent(Shard, EventId);
+
+	const FGameEventListenerKey ListenerKey = NewListener.GetKey();
+	if (Shard.Events.FindListener(EventIndex, ListenerKey).IsValid())
 	{
 		GES_LOG_WARNING(TEXT("Event[%s] - Listener already exists, skipping duplicate registration: %s"),
 		                *EventId.GetName(),
 		                *NewListener.ToString());
-		return;
+		return FGameEventListenerHandle();
 	}
 
-	TargetEvent.Listeners.Add(NewListener);
-
-	// Update receiver mapping table
-	FListener ListenerContext;
-	ListenerContext.EventId = EventId;
-	ListenerContext.Listener = NewListener;
-
-	TArray<FListener>* ReceiverListeners = ReceiverMap.Find(NewListener.Receiver.Get());
-	if (!ReceiverListeners)
+	const FGameEventListenerHandle ListenerHandle = Shard.Listeners.Add(NewListener, EventHandle, ListenerKey);
+	if (!ListenerHandle.IsValid())
 	{
-		ReceiverMap.Add(NewListener.Receiver.Get(), TArray<FListener>());
-		ReceiverListeners = ReceiverMap.Find(NewListener.Receiver.Get());
+		if (Shard.Events.NumListeners(EventIndex) == 0 && !Shard.Events.GetHot(EventIndex).bPinned)
+		{
+			RemoveEvent(Shard, EventIndex);
+		}
+		return FGameEventListenerHandle();
 	}
 
-	ReceiverListeners->Add(ListenerContext);
+	Shard.Events.AddListener(EventIndex, ListenerKey, ListenerHandle, NewListener.Priority);
+	PublishEvent(Shard, EventIndex);
 
-	// If it's a Lambda listener, add it to Lambda mapping table
-	if (NewListener.IsBoundToLambda() && !NewListener.FunctionName.IsEmpty())
-	{
-		LambdaListenerMap.Add(NewListener.FunctionName, NewListener);
-	}
+	AddReceiverEntry(FObjectKey(NewListener.Receiver.Get()), EventHandle, ListenerHandle);
 
 	GES_LOG_DISPLAY(TEXT("Event[%s] - Listener registered successfully -> %s"), *EventId.GetName(), *NewListener.ToString());
 
 	// Handle immediate trigger for pinned events
-	if (TargetEvent.bPinned)
+	if (Shard.Events.GetHot(EventIndex).bPinned)
 	{
 		GES_LOG_DISPLAY(TEXT("Event[%s] - Pinned event detected, preparing to send to new listener"), *EventId.GetName());
 
-		if (TargetEvent.HasValidParameters())
-		{
-			SendSpecificEventInternal(&NewListener, TargetEvent);
-		}
-		else
+		// Keep a reference to the pinned payload so the listener runs without holding the lock
+		FEventContext PinnedContext(static_cast<const FEventContextBase&>(Shard.Events.GetEvent(EventIndex)));
+		const FGameEventPinnedPayloadRef PinnedPayload = Shard.PinnedPayloads.FindRef(EventHandle);
+		const FListenerRecord Record = Shard.Listeners.Find(ListenerHandle)->Listener.ToSharedRef();
+		Lock.Unlock();
+
+		FAsyncDispatch AsyncDispatch;
+		if (PinnedPayload.IsValid())
 		{
-			SendEventInternal(&NewListener);
-			GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventId.GetName(), *NewListener.ToString());
+			PinnedContext.PropertyContexts = PinnedPayload->GetPropertyContexts();
+			AsyncDispatch.Payload = PinnedPayload;
 		}
+
+		DispatchToListeners(MakeArrayView(&Record, 1), PinnedContext, nullptr, &AsyncDispatch);
 	}
+
+	return ListenerHandle;
 }
 
-void FGameEventManager::AddListenerFunction(const FEventId& EventId, UObject* Receiver, const FString& FunctionName)
+FGameEventListenerHandle FGameEventManager::AddListenerFunction(const FEventId& EventId,
+                                                               UObject* Receiver,
+                                                               const FString& FunctionName,
+                                                               const FGameEventTagFilter& TagFilter,
+                                                               const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+                                                               const int32 Priority)
 {
 	if (!Receiver || FunctionName.IsEmpty())
 	{
 		GES_LOG_WARNING(TEXT("Event[%s] - AddListenerFunction Failed"), *EventId.GetName());
-		return;
+		return FGameEventListenerHandle();
 	}
 
 	FListenerContext Listener;
 	Listener.Receiver = Receiver;
 	Listener.FunctionName = FunctionName;
+	Listener.SetTagFilter(TagFilter);
+	Listener.SetPayloadPredicates(PayloadPredicates);
+	Listener.Priority = Priority;
 
 	// Try to link function
 	if (Listener.LinkFunction())
 	{
-		AddListener(EventId, Listener);
-	}
-	else
-	{
-		GES_LOG_WARNING(TEXT("Event[%s] Failed to find function '%s' in object '%s'"),
-		                *EventId.GetName(),
-		                *FunctionName,
-		                *Receiver->GetClass()->GetName());
+		return AddListener(EventId, Listener);
 	}
+
+	GES_LOG_WARNING(TEXT("Event[%s] Failed to find function '%s' in object '%s'"),
+	                *EventId.GetName(),
+	                *FunctionName,
+	                *Receiver->GetClass()->GetName());
+	return FGameEventListenerHandle();
 }
 
 #pragma endregion
 
 void FGameEventManager::RemoveListener(const FEventId& EventId, const FListenerContext& Listener)
 {
-	FScopeLock Lock(&CriticalSection);
+	const FGameEventHandle EventHandle = EventId.GetHandle();
+	FEventShard& Shard = GetShard(EventHandle);
+	FScopeLock Lock(&Shard.CriticalSection);
 
-	if (!EventMap.Contains(EventId))
+	const int32 EventIndex = Shard.Events.Find(EventHandle);
+	if (EventIndex == INDEX_NONE)
 	{
 		GES_LOG_WARNING(TEXT("Event[%s] - Attempting to remove listener from non-existent event"), *EventId.GetName());
 		return;
 	}
 
-	FEventContext& TargetEvent = EventMap[EventId];
-	const int32 OriginalListenerCount = TargetEvent.Listeners.Num();
-	int32 RemovedCount = 0;
-	int32 InvalidRemovedCount = 0;
-
-	// Iterate backwards to safely remove elements
-	for (int32 i = OriginalListenerCount - 1; i >= 0; --i)
+	const FGameEventListenerHandle ListenerHandle = Shard.Events.RemoveListener(EventIndex, Listener.GetKey());
+	if (!ListenerHandle.IsValid())
 	{
-		const FListenerContext& CurrentListener = TargetEvent.Listeners[i];
-
-		if (!CurrentListener.Receiver.IsValid())
-		{
-			TargetEvent.Listeners.RemoveAt(i);
-			InvalidRemovedCount++;
-			GES_LOG_DISPLAY(TEXT("Event[%s] - Cleaning up invalid listener, index: %d"), *EventId.GetName(), i);
-			continue;
-		}
-
-		if (CurrentListener == Listener)
-		{
-			TargetEvent.Listeners.RemoveAt(i);
-			RemovedCount++;
-
-			if (UObject* ReceiverObj = Listener.Receiver.Get())
-			{
-				if (TArray<FListener>* Contexts = ReceiverMap.Find(ReceiverObj))
-				{
-					for (int32 j = Contexts->Num() - 1; j >= 0; --j)
-					{
-						const FListener& Context = (*Contexts)[j];
-						if (Context.EventId == EventId && Context.Listener == Listener)
-						{
-							Contexts->RemoveAt(j);
-							break;
-						}
-					}
-
-					if (Contexts->Num() == 0)
-					{
-						ReceiverMap.Remove(ReceiverObj);
-						GES_LOG_DISPLAY(TEXT("Event[%s] All listeners for receiver [%s] have been removed, cleaning from mapping table"), *EventId.GetName(), *ReceiverObj->GetName());
-					}
-				}
-			}
+		GES_LOG_WARNING(TEXT("Event[%s] - Listener to remove not found in [%s]"), *EventId.GetName(), *Listener.ToString());
+		return;
+	}
 
-			// If it's a Lambda listener, also remove from Lambda mapping table
-			if (Listener.IsBoundToLambda() && !Listener.FunctionName.IsEmpty())
-			{
-				LambdaListenerMap.Remove(Listener.FunctionName);
-			}
+	ReleaseListener(Shard, ListenerHandle);
 
-			GES_LOG_DISPLAY(TEXT("Event[%s] Listener removed successfully -> %s"), *EventId.GetName(), *Listener.ToString());
+	const int32 RemainingCount = Shard.Events.NumListeners(EventIndex);
+	GES_LOG_DISPLAY(TEXT("Event[%s] Listener removed successfully -> %s, current count: %d"), *EventId.GetName(), *Listener.ToString(), RemainingCount);
 
-			break;
-		}
-	}
-
-	if (RemovedCount > 0)
-	{
-		GES_LOG_DISPLAY(TEXT("Event[%s] - Listener removal completed - Removed %d target listeners, cleaned %d invalid listeners, current count: %d"), *EventId.GetName(), RemovedCount, InvalidRemovedCount, TargetEvent.Listeners.Num());
-	}
-	else if (InvalidRemovedCount > 0)
+	// Check if event still has listeners, delete event if not
+	if (RemainingCount == 0 && !Shard.Events.GetHot(EventIndex).bPinned)
 	{
-		GES_LOG_DISPLAY(TEXT("Event[%s] - Cleaned %d invalid listeners, but target listener not found"), *EventId.GetName(), InvalidRemovedCount);
+		RemoveEvent(Shard, EventIndex);
+		GES_LOG_DISPLAY(TEXT("Event[%s] - No listeners remaining, event deleted"), *EventId.GetName());
 	}
 	else
 	{
-		GES_LOG_WARNING(TEXT("Event[%s] - Listener to remove not found in [%s]"), *EventId.GetName(), *Listener.ToString());
-	}
-
-	// Check if event still has listeners, delete event if not
-	if (TargetEvent.Listeners.Num() == 0 && !TargetEvent.bPinned)
-	{
-		EventMap.Remove(EventId);
-		GES_LOG_DISPLAY(TEXT("Event[%s] - No listeners remaining, event deleted"), *EventId.GetName());
+		PublishEvent(Shard, EventIndex);
 	}
 }
 
@@ -495,17 +583,16 @@ void FGameEventManager::RemoveAllListenersForReceiver(const FEventId& EventId, c
 		return;
 	}
 
-	FScopeLock Lock(&CriticalSection);
-
-	if (!EventMap.Contains(EventId))
+	const FGameEventHandle EventHandle = EventId.GetHandle();
+	if (!HasEvent(EventId))
 	{
 		GES_LOG_WARNING(TEXT("Event[%s] - Event does not exist"), *EventId.GetName());
 		return;
 	}
 
 	// Call internal generic method, only process specified events
-	TSet<FEventId> EventsToProcess;
-	EventsToProcess.Add(EventId);
+	TSet<FGameEventHandle> EventsToProcess;
+	EventsToProcess.Add(EventHandle);
 
 	int32 RemovedCount = RemoveListenersForReceiverInternal(Receiver, &EventsToProcess);
 
@@ -519,31 +606,75 @@ void FGameEventManager::RemoveAllListenersForReceiver(const FEventId& EventId, c
 	}
 }
 
-void FGameEventManager::RemoveLambdaListener(const FEventId& EventId, const FString& LambdaListenerId)
+void FGameEventManager::RemoveListener(const FGameEventListenerHandle ListenerHandle)
 {
-	if (LambdaListenerId.IsEmpty())
+	if (!ListenerHandle.IsValid() || ListenerHandle.GetPool() >= static_cast<uint32>(NumShards))
+	{
+		return;
+	}
+
+	// The handle names the shard that owns the listener, no event lookup by name is needed
+	FEventShard& Shard = Shards[ListenerHandle.GetPool()];
+	FScopeLock Lock(&Shard.CriticalSection);
+
+	const FGameEventListenerPool::FEntry* Entry = Shard.Listeners.Find(ListenerHandle);
+	if (!Entry)
 	{
-		GES_LOG_WARNING(TEXT("Event[%s] - Lambda listener ID cannot be empty"), *EventId.GetName());
+		GES_LOG_WARNING(TEXT("Listener [%s] not found, it was already removed"), *ListenerHandle.ToString());
 		return;
 	}
 
-	FScopeLock Lock(&CriticalSection);
+	const FGameEventHandle EventHandle = Entry->EventHandle;
+	const FString ListenerName = Entry->Listener->ToString();
+
+	const int32 EventIndex = Shard.Events.Find(EventHandle);
+	if (EventIndex != INDEX_NONE)
+	{
+		Shard.Events.RemoveListener(EventIndex, Entry->Key);
+	}
+	ReleaseListener(Shard, ListenerHandle);
+
+	const FString EventName = FEventId(EventHandle).GetName();
+	GES_LOG_DISPLAY(TEXT("Event[%s] Listener removed successfully -> %s"), *EventName, *ListenerName);
 
-	FListenerContext* LambdaListener = LambdaListenerMap.Find(LambdaListenerId);
-	if (!LambdaListener)
+	if (EventIndex == INDEX_NONE)
 	{
-		GES_LOG_WARNING(TEXT("Event[%s] - Lambda listener [%s] not found"), *EventId.GetName(), *LambdaListenerId);
 		return;
 	}
 
-	// Copy listener information and remove from mapping table
-	FListenerContext ListenerToRemove = *LambdaListener;
-	LambdaListenerMap.Remove(LambdaListenerId);
+	// Check if event still has listeners, delete event if not
+	if (Shard.Events.NumListeners(EventIndex) == 0 && !Shard.Events.GetHot(EventIndex).bPinned)
+	{
+		RemoveEvent(Shard, EventIndex);
+		GES_LOG_DISPLAY(TEXT("Event[%s] - No listeners remaining, event deleted"), *EventName);
+	}
+	else
+	{
+		PublishEvent(Shard, EventIndex);
+	}
+}
 
-	// Remove listener from event
-	RemoveListenerFromEvent(EventId, ListenerToRemove);
+void FGameEventManager::AddReceiverEntry(const FObjectKey ReceiverKey, const FGameEventHandle EventHandle, const FGameEventListenerHandle ListenerHandle)
+{
+	FScopeLock ReceiverLock(&ReceiverCriticalSection);
 
-	GES_LOG_DISPLAY(TEXT("Event[%s] - Lambda listener [%s] removed successfully"), *EventId.GetName(), *LambdaListenerId);
+	ReceiverMap.FindOrAdd(ReceiverKey).Add(FListener(EventHandle, ListenerHandle));
+}
+
+void FGameEventManager::RemoveReceiverEntry(const FObjectKey ReceiverKey, const FGameEventHandle EventHandle, const FGameEventListenerHandle ListenerHandle)
+{
+	FScopeLock ReceiverLock(&ReceiverCriticalSection);
+
+	if (TSet<FListener>* Contexts = ReceiverMap.Find(ReceiverKey))
+	{
+		Contexts->Remove(FListener(EventHandle, ListenerHandle));
+
+		if (Contexts->Num() == 0)
+		{
+			ReceiverMap.Remove(ReceiverKey);
+			GES_LOG_DISPLAY(TEXT("All listeners for receiver [%s] have been removed, cleaning from mapping table"), *GetNameSafe(ReceiverKey.ResolveObjectPtr()));
+		}
+	}
 }
 #pragma endregion  "Listener"
 
@@ -551,42 +682,217 @@ void FGameEventManager::RemoveLambdaListener(const FEventId& EventId, const FStr
 
 bool FGameEventManager::SendEvent(const FEventContext& EventContext)
 {
-	FScopeLock Lock(&CriticalSection);
+	return SendEventInternal(EventContext, nullptr);
+}
+
+bool FGameEventManager::SendEvent(const FEventContext& EventContext, UE::Tasks::FTask& OutAsyncListeners)
+{
+	FAsyncDispatch AsyncDispatch;
+	const bool bSent = SendEventInternal(EventContext, nullptr, &AsyncDispatch);
+
+	if (AsyncDispatch.Tasks.Num() == 1)
+	{
+		OutAsyncListeners = AsyncDispatch.Tasks[0];
+	}
+	else if (AsyncDispatch.Tasks.Num() > 1)
+	{
+		// Empty task that completes with the last listener
+		OutAsyncListeners = UE::Tasks::Launch(UE_SOURCE_LOCATION, [] {}, AsyncDispatch.Tasks);
+	}
+	else
+	{
+		OutAsyncListeners = UE::Tasks::FTask();
+	}
+	return bSent;
+}
+
+bool FGameEventManager::SendEventInternal(const FEventContext& EventContext, FGameEventPinnedPayloadRef PinnedPayload, FAsyncDispatch* AsyncDispatch)
+{
+	// Async listeners share the payload of the send, a pinned payload already is an immutable manager-owned copy
+	FAsyncDispatch LocalAsyncDispatch;
+	FAsyncDispatch& AsyncListeners = AsyncDispatch ? *AsyncDispatch : LocalAsyncDispatch;
+
+	// Only a pinned event or a name some wildcard subscription matches is interned, other unknown names have nobody to reach
+	FGameEventHandle EventHandle = EventContext.EventId.GetHandle();
+	if (!EventHandle.IsValid() && (EventContext.bPinned || (!WildcardIndex.IsEmpty() && WildcardIndex.HasMatch(EventContext.EventId.GetName()))))
+	{
+		EventHandle = EventContext.EventId.FindOrAddHandle();
+	}
+
+	// One lookup gives the listeners of every wildcard subscription matching this event, only made once it is needed
+	const auto FindWildcardListeners = [this, EventHandle]()
+	{
+		FListenerSnapshot Listeners;
+		if (EventHandle.IsValid() && !WildcardIndex.IsEmpty())
+		{
+			Listeners = WildcardIndex.Find(EventHandle);
+		}
+		if (Listeners.IsValid() && Listeners->Listeners.Num() == 0)
+		{
+			Listeners.Reset();
+		}
+		return Listeners;
+	};
 
-	if (!EventMap.Contains(EventContext.EventId))
+	// Nothing listens to the exact event and nothing has to be pinned: return before touching the shard, so unobserved events never get a record
+	if (!EventContext.bPinned && (!EventHandle.IsValid() || FindListenerCount(EventHandle) == INDEX_NONE))
 	{
-		CreateEvent(EventContext.EventId, EventContext.bPinned);
+		const FListenerSnapshot WildcardListeners = FindWildcardListeners();
+		if (WildcardListeners.IsValid())
+		{
+			DispatchToListeners(*WildcardListeners, EventContext, &AsyncListeners);
+			return true;
+		}
+
+		NumSendsWithNoListeners.fetch_add(1, std::memory_order_relaxed);
+		INC_DWORD_STAT(STAT_GameEvent_SendsWithNoListeners);
+		GES_LOG_WARNING(TEXT("Event[%s] - No listeners registered"), *EventContext.EventId.GetName());
+		return true;
 	}
 
-	FEventContext& TargetEvent = EventMap[EventContext.EventId];
+	// Late listeners of a pinned event read a manager-owned copy, never the sender's stack or VM frame
+	if (EventContext.bPinned && !PinnedPayload.IsValid() && EventContext.HasValidParameters())
+	{
+		PinnedPayload = PinnedPayloadStore.Copy(EventContext.PropertyContexts);
+	}
+	if (PinnedPayload.IsValid())
+	{
+		AsyncListeners.Payload = PinnedPayload;
+	}
 
-	// Set multi-parameter context
-	TargetEvent.SetPropertyContexts(EventContext.PropertyContexts);
+	// The previous payload is released after the lock, its values may have non-trivial destructors
+	FGameEventPinnedPayloadRef ReplacedPayload;
+	FListenerSnapshot Snapshot;
+	{
+		FEventShard& Shard = GetShard(EventHandle);
+		FScopeLock Lock(&Shard.CriticalSection);
 
-	TargetEvent.bPinned = EventContext.bPinned;
+		// Only a pinned send needs a record, an unpinned one to an event removed since the fast path has nobody to reach
+		const int32 EventIndex = EventContext.bPinned ? CreateEvent(Shard, EventContext.EventId, true) : Shard.Events.Find(EventHandle);
+		if (EventIndex != INDEX_NONE)
+		{
+			FGameEventTable::FHotRecord& TargetEvent = Shard.Events.GetHot(EventIndex);
+			TargetEvent.bPinned = EventContext.bPinned;
 
-	if (TargetEvent.Listeners.Num() == 0)
+			if (EventContext.bPinned && PinnedPayload.IsValid())
+			{
+				FGameEventPinnedPayloadRef& StoredPayload = Shard.PinnedPayloads.FindOrAdd(EventHandle);
+				ReplacedPayload = MoveTemp(StoredPayload);
+				StoredPayload = PinnedPayload;
+			}
+			else
+			{
+				Shard.PinnedPayloads.RemoveAndCopyValue(EventHandle, ReplacedPayload);
+			}
+
+			Snapshot = TargetEvent.ListenerSnapshot;
+
+			// The unpinned send cleared the pin, a record left with neither listeners nor a pin is not kept
+			if (!EventContext.bPinned && Shard.Events.NumListeners(EventIndex) == 0)
+			{
+				RemoveEvent(Shard, EventIndex);
+			}
+		}
+	}
+
+	// Dispatch iterates the immutable snapshot with no lock held, listeners may add or remove listeners freely
+	if (!Snapshot.IsValid() || Snapshot->Listeners.Num() == 0)
 	{
-		if (TargetEvent.bPinned && TargetEvent.HasValidParameters())
+		const FListenerSnapshot WildcardListeners = FindWildcardListeners();
+		if (WildcardListeners.IsValid())
 		{
-			GES_LOG_DISPLAY(TEXT("Event[%s] - Pinned event saved with %d parameters, waiting for listener registration"), *EventContext.EventId.GetName(), TargetEvent.GetParameterCount());
+			DispatchToListeners(*WildcardListeners, EventContext, &AsyncListeners);
+			return true;
+		}
+
+		if (EventContext.bPinned && EventContext.HasValidParameters())
+		{
+			GES_LOG_DISPLAY(TEXT("Event[%s] - Pinned event saved with %d parameters, waiting for listener registration"), *EventContext.EventId.GetName(), EventContext.GetParameterCount());
 		}
 		else
 		{
 			GES_LOG_WARNING(TEXT("Event[%s] - Pinned No listeners registered"), *EventContext.EventId.GetName());
 		}
+		NumSendsWithNoListeners.fetch_add(1, std::memory_order_relaxed);
+		INC_DWORD_STAT(STAT_GameEvent_SendsWithNoListeners);
 		return true;
 	}
 
-	for (FListenerContext& Listener : TargetEvent.Listeners)
+	DispatchToListeners(*Snapshot, EventContext, &AsyncListeners);
+
+	// A SpecificTarget send was consumed by the exact listeners already
+	const bool bTargeted = EventContext.HasValidParameters() && EventContext.SpecificTarget && EventContext.SpecificTarget->IsValid();
+	if (!bTargeted)
+	{
+		const FListenerSnapshot WildcardListeners = FindWildcardListeners();
+		if (WildcardListeners.IsValid())
+		{
+			DispatchToListeners(*WildcardListeners, EventContext, &AsyncListeners);
+		}
+	}
+
+	return true;
+}
+
+int32 FGameEventManager::DispatchToListeners(const FGameEventListenerSnapshot& Snapshot, const FEventContext& EventContext, FAsyncDispatch* AsyncDispatch)
+{
+	return DispatchToListeners(Snapshot.Listeners, EventContext, &Snapshot.TagFilters, AsyncDispatch);
+}
+
+int32 FGameEventManager::DispatchToListeners(const TConstArrayView<FListenerRecord> Listeners,
+                                             const FEventContext& EventContext,
+                                             const FGameEventTagFilterTable* TagFilters,
+                                             FAsyncDispatch* AsyncDispatch)
+{
+	// Payload fingerprint and shared parameter frames live for the whole send
+	FGameEventDispatchScope DispatchScope(EventContext.PropertyContexts);
+	FAsyncDispatch LocalAsyncDispatch;
+
+	// A SpecificTarget send is consumed inline by the first listener, async listeners included
+	const bool bTargeted = EventContext.HasValidParameters() && EventContext.SpecificTarget && EventContext.SpecificTarget->IsValid();
+
+	// Tag filters are tested for the whole list at once, rejected listeners are never called
+	FGameplayTagContainer ScratchTags;
+	TBitArray<> Passed;
+	const bool bPrefiltered = TagFilters && !TagFilters->IsEmpty();
+	if (bPrefiltered)
 	{
+		TagFilters->Evaluate(FGameEventTagFilterTable::GetPayloadTags(EventContext.PropertyContexts, ScratchTags), Passed);
+	}
+
+	int32 NumInvalid = 0;
+	for (int32 ListenerIndex = 0; ListenerIndex < Listeners.Num(); ++ListenerIndex)
+	{
+		const FListenerContext& Listener = *Listeners[ListenerIndex];
 		if (!Listener.IsValid())
 		{
+			++NumInvalid;
 			continue;
 		}
-		if (TargetEvent.HasValidParameters())
+		if (bPrefiltered)
 		{
-			if (SendSpecificEventInternal(&Listener, TargetEvent))
+			if (!Passed[ListenerIndex])
+			{
+				continue;
+			}
+		}
+		else if (Listener.TagFilter.IsValid() && !Listener.TagFilter->Matches(FGameEventTagFilterTable::GetPayloadTags(EventContext.PropertyContexts, ScratchTags)))
+		{
+			continue;
+		}
+		// Field predicates run on the payload memory, before a parameter frame is built for the listener
+		if (Listener.PayloadPredicate.IsValid() && !Listener.PayloadPredicate->Evaluate(EventContext.PropertyContexts, DispatchScope.GetPayloadFingerprint(), Listener.Receiver.Get()))
+		{
+			continue;
+		}
+		if (Listener.AsyncLambdaFunction.IsValid() && !bTargeted)
+		{
+			LaunchAsyncListener(Listener, EventContext, AsyncDispatch ? *AsyncDispatch : LocalAsyncDispatch);
+			continue;
+		}
+		if (EventContext.HasValidParameters())
+		{
+			if (SendSpecificEventInternal(&Listener, EventContext, DispatchScope))
 			{
 				break;
 			}
@@ -598,30 +904,49 @@ bool FGameEventManager::SendEvent(const FEventContext& EventContext)
 		}
 	}
 
-	return true;
-}
+	return NumInvalid;
+}
+
+void FGameEventManager::LaunchAsyncListener(const FListenerContext& Listener, const FEventContext& EventContext, FAsyncDispatch& AsyncDispatch)
+{
+	// One copy per send, whatever the number of async listeners
+	if (!AsyncDispatch.Payload.IsValid() && EventContext.HasValidParameters())
+	{
+		AsyncDispatch.Payload = PinnedPayloadStore.Copy(EventContext.PropertyContexts);
+	}
+
+	// The manager is kept alive for the store the payload returns its memory to. The store reports the objects of its
+	// live payloads to the garbage collector, so the payload's objects outlive every task holding it
+	auto TaskBody = [Manager = AsShared(), Lambda = Listener.AsyncLambdaFunction, Payload = AsyncDispatch.Payload]()
+	{
+		// Same calling convention as the inline path: the whole parameter list, or nothing
+		FPropertyContext ParamProperty;
+		ParamProperty.Property = nullptr;
+		ParamProperty.PropertyPtr = Payload.IsValid() ? const_cast<void*>(static_cast<const void*>(&Payload->GetPropertyContexts())) : nullptr;
+
+		(*Lambda)(ParamProperty);
+	};
 
-bool FGameEventManager::SendEventInternal(const FEventId& EventId, UObject* WorldContext, const bool bPinned, const TArray<FPropertyContext>& PropertyContexts)
-{
-	if (!WorldContext)
+	if (Listener.Execution == EGameEventExecution::Pipe)
 	{
-		return false;
+		AsyncDispatch.Tasks.Add(GameEventPipes::Get(Listener.PipeName).Launch(TEXT("GameEventListener"), MoveTemp(TaskBody)));
+	}
+	else
+	{
+		AsyncDispatch.Tasks.Add(UE::Tasks::Launch(TEXT("GameEventListener"), MoveTemp(TaskBody)));
 	}
 
-	FEventContext EventContext;
-	EventContext.WorldContext = WorldContext;
-	EventContext.EventId = EventId;
-	EventContext.bPinned = bPinned;
-	EventContext.SetPropertyContexts(PropertyContexts);
-
-	return SendEvent(EventContext);
+	GES_LOG_DISPLAY(TEXT("Event[%s] -Launched async listener -> %s"), *EventContext.EventId.GetName(), *Listener.ToString());
 }
 
 void FGameEventManager::SendEventInternal(const FListenerContext* Listener)
 {
 	if (Listener->Function)
 	{
-		if (!ValidateFunctionParameters(Listener->Function, TArray<FPropertyContext>()))
+		const bool bTakesNoParams = Listener->FunctionLayout.IsValid()
+				? Listener->FunctionLayout->Params.Num() == 0
+				: ValidateFunctionParameters(Listener->Function, TArray<FPropertyContext>());
+		if (!bTakesNoParams)
 		{
 			GES_LOG_WARNING(TEXT("Function[%s] has invalid parameters"), *Listener->Function->GetName());
 			return;
@@ -643,29 +968,36 @@ void FGameEventManager::SendEventInternal(const FListenerContext* Listener)
 	}
 }
 
-bool FGameEventManager::SendSpecificEventInternal(const FListenerContext* Listener, const FEventContext& EventContext)
+bool FGameEventManager::SendSpecificEventInternal(const FListenerContext* Listener, const FEventContext& EventContext, FGameEventDispatchScope& DispatchScope)
 {
 	if (EventContext.PropertyContexts.Num() > 0 && EventContext.SpecificTarget && EventContext.SpecificTarget->IsValid())
 	{
-		SendPropertyEvent(EventContext.SpecificTarget, EventContext);
+		SendPropertyEvent(EventContext.SpecificTarget, EventContext, DispatchScope);
 		return true;
 	}
-	SendPropertyEvent(Listener, EventContext);
+	SendPropertyEvent(Listener, EventContext, DispatchScope);
 	return false;
 }
 
-void FGameEventManager::SendPropertyEvent(const FListenerContext* Listener, const FEventContext& EventContext)
+void FGameEventManager::SendPropertyEvent(const FListenerContext* Listener, const FEventContext& EventContext, FGameEventDispatchScope& DispatchScope)
 {
-	const FString EventKey = EventContext.EventId.GetName();
-
 	// Use multi-parameter context
 	const TArray<FPropertyContext>& PropertyContexts = EventContext.PropertyContexts;
 
 	if (Listener->Function)
 	{
-		SendFunctionEvent(Listener, PropertyContexts);
+		SendFunctionEvent(Listener, PropertyContexts, DispatchScope);
+
+		GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventContext.EventId.GetName(), *Listener->ToString());
+		return;
+	}
+
+	// Native sender and native listener agree on the argument list, skip the property marshaling
+	if (Listener->TypedPayloadId == EventContext.TypedPayloadId && EventContext.TypedPayload)
+	{
+		Listener->TypedLambdaFunction(EventContext.TypedPayload);
 
-		GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventKey, *Listener->ToString());
+		GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventContext.EventId.GetName(), *Listener->ToString());
 		return;
 	}
 
@@ -688,42 +1020,59 @@ void FGameEventManager::SendPropertyEvent(const FListenerContext* Listener, cons
 
 		Listener->LambdaFunction(ParamProperty);
 
-		GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventKey, *Listener->ToString());
+		GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventContext.EventId.GetName(), *Listener->ToString());
 		return;
 	}
 
 	if (Listener->PropertyDelegate.IsBound())
 	{
 		Listener->PropertyDelegate.Execute(PropertyContexts);
-		GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventKey, *Listener->ToString());
+		GES_LOG_DISPLAY(TEXT("Event[%s] -Triggered successfully -> %s"), *EventContext.EventId.GetName(), *Listener->ToString());
 	}
 }
 
-void FGameEventManager::SendFunctionEvent(const FListenerContext* Listener, const TArray<FPropertyContext>& PropertyContexts)
+void FGameEventManager::SendFunctionEvent(const FListenerContext* Listener, const TArray<FPropertyContext>& PropertyContexts, FGameEventDispatchScope& DispatchScope)
 {
+	const FGameEventFunctionLayout* Layout = Listener->FunctionLayout.Get();
+	if (!Layout)
+	{
+		GES_LOG_WARNING(TEXT("Function[%s] was not linked through AddListener"), *Listener->Function->GetName());
+		return;
+	}
+
 	// Check validity and compatibility of each parameter
-	if (!ValidateFunctionParameters(Listener->Function, PropertyContexts))
+	if (!Layout->Accepts(Listener->Function, PropertyContexts, DispatchScope.GetPayloadFingerprint()))
 	{
 		return;
 	}
 
-	uint8* ParamsBuffer = static_cast<uint8*>(FMemory::Malloc(Listener->Function->ParmsSize));
-	FMemory::Memzero(ParamsBuffer, Listener->Function->ParmsSize);
+	// Functions that cannot write to their parameters share one frame per layout for the whole send
+	if (Layout->bCanShareFrame)
+	{
+		uint8* SharedFrame = DispatchScope.FindSharedFrame(*Layout);
+		if (!SharedFrame)
+		{
+			SharedFrame = DispatchScope.AddSharedFrame(Listener->FunctionLayout);
+			ProcessFunctionParameters(Layout->Params, PropertyContexts, SharedFrame, Listener->Function->GetName());
+		}
+
+		Listener->Receiver->ProcessEvent(Listener->Function, SharedFrame);
+		return;
+	}
 
-	TArray<FProperty*> Params;
-	GetFunctionParameters(Listener->Function, Params);
+	const FGameEventScopedParamsBuffer ScopedParamsBuffer(Layout->ParmsSize, Layout->MinAlignment);
+	uint8* ParamsBuffer = ScopedParamsBuffer.GetData();
 
 	// Use multi-parameter version of processing function
-	ProcessFunctionParameters(Params, PropertyContexts, ParamsBuffer, Listener->Function->GetName());
+	ProcessFunctionParameters(Layout->Params, PropertyContexts, ParamsBuffer, Listener->Function->GetName());
 
 	Listener->Receiver->ProcessEvent(Listener->Function, ParamsBuffer);
 
-	// Clean up parameter memory
-	for (FProperty* Prop : Params)
+	// Clean up parameter memory, including values the function wrote to its out and return parameters
+	for (int32 Index = 0; Index < Layout->DestructParams.Num(); ++Index)
 	{
-		Prop->DestroyValue_InContainer(ParamsBuffer);
+		Layout->DestructParams[Index]->DestroyValue(ParamsBuffer + Layout->DestructOffsets[Index]);
 	}
-	FMemory::Free(ParamsBuffer);
 }
 
 void FGameEventManager::ProcessFunctionParameters(const TArray<FProperty*>& Params, const TArray<FPropertyContext>& PropertyContexts, uint8* ParamsBuffer, const FString& FunctionName)
@@ -923,44 +1272,204 @@ void FGameEventManager::CopyEnumProperty(FProperty* DestProperty, const FBytePro
 }
 #pragma endregion  "Send"
 
+#pragma region  "Queue"
+
+bool FGameEventManager::QueueEvent(const FEventContext& EventContext)
+{
+	if (!EventContext.EventId.IsValid())
+	{
+		GES_LOG_WARNING(TEXT("GameEventManager:QueueEvent, Invalid event id"));
+		return false;
+	}
+
+	EventQueue.Enqueue(EventContext);
+	GES_LOG_VERY_VERBOSE(TEXT("Event[%s] - Queued with %d parameters"), *EventContext.EventId.GetName(), EventContext.GetParameterCount());
+	return true;
+}
+
+int32 FGameEventManager::FlushQueuedEvents()
+{
+	const int32 NumThreadedEvents = DrainThreadedEvents();
+
+	return NumThreadedEvents + EventQueue.Flush([this](const FEventContext& EventContext)
+	{
+		SendEvent(EventContext);
+	});
+}
+
+int32 FGameEventManager::GetQueuedEventCount() const
+{
+	return EventQueue.Num();
+}
+
+void FGameEventManager::SetEventLane(const FEventId& EventId, const EGameEventLane Lane)
+{
+	if (!EventId.IsValid() || Lane >= EGameEventLane::Count)
+	{
+		return;
+	}
+
+	EventQueue.SetEventLane(EventId.FindOrAddHandle(), Lane);
+	GES_LOG_DISPLAY(TEXT("Event[%s] - Queued sends flush in lane %s"), *EventId.GetName(), *UEnum::GetValueAsString(Lane));
+}
+
+EGameEventLane FGameEventManager::GetEventLane(const FEventId& EventId) const
+{
+	return EventQueue.GetEventLane(EventId.GetHandle());
+}
+
+void FGameEventManager::SetQueueLaneConfig(const EGameEventLane Lane, const FGameEventLaneConfig& Config)
+{
+	EventQueue.SetLaneConfig(Lane, Config);
+}
+
+FGameEventLaneStats FGameEventManager::GetQueueLaneStats(const EGameEventLane Lane) const
+{
+	return EventQueue.GetLaneStats(Lane);
+}
+
+void FGameEventManager::SetEventCoalescing(const FEventId& EventId, const bool bCoalesce)
+{
+	if (!EventId.IsValid())
+	{
+		return;
+	}
+
+	EventQueue.SetCoalescing(EventId.FindOrAddHandle(), bCoalesce);
+	GES_LOG_DISPLAY(TEXT("Event[%s] - Queued sends %s"), *EventId.GetName(), bCoalesce ? TEXT("coalesce to the latest payload") : TEXT("are no longer coalesced"));
+}
+
+bool FGameEventManager::IsEventCoalescing(const FEventId& EventId) const
+{
+	return EventQueue.IsCoalescing(EventId.GetHandle());
+}
+
+bool FGameEventManager::QueueEventFromAnyThread(const EGameEventProducer Producer, const FEventContext& EventContext)
+{
+	if (!EventContext.EventId.IsValid() || Producer >= EGameEventProducer::Count)
+	{
+		return false;
+	}
+
+	// The stamp is taken before the push so the drain can order events from different rings
+	const uint64 Stamp = ThreadedSendStamp.fetch_add(1, std::memory_order_relaxed);
+	return ThreadQueues[static_cast<int32>(Producer)]->Push(EventContext, Stamp);
+}
+
+int32 FGameEventManager::DrainThreadedEvents()
+{
+	check(IsInGameThread());
+
+	// Events pushed while draining wait for the next drain, so a busy producer cannot stall the game thread
+	const uint64 StampLimit = ThreadedSendStamp.load(std::memory_order_relaxed);
+
+	int32 NumDelivered = 0;
+	for (;;)
+	{
+		int32 OldestProducer = INDEX_NONE;
+		uint64 OldestStamp = StampLimit;
+		for (int32 Producer = 0; Producer < static_cast<int32>(EGameEventProducer::Count); ++Producer)
+		{
+			const uint64 Stamp = ThreadQueues[Producer]->PeekStamp();
+			if (Stamp < OldestStamp)
+			{
+				OldestStamp = Stamp;
+				OldestProducer = Producer;
+			}
+		}
+
+		if (OldestProducer == INDEX_NONE)
+		{
+			break;
+		}
+
+		if (ThreadQueues[OldestProducer]->PopAndDispatch([this](const FEventContext& EventContext)
+		{
+			SendEvent(EventContext);
+		}))
+		{
+			++NumDelivered;
+		}
+	}
+
+	return NumDelivered;
+}
+
+FGameEventThreadQueueStats FGameEventManager::GetThreadQueueStats(const EGameEventProducer Producer) const
+{
+	if (Producer >= EGameEventProducer::Count)
+	{
+		return FGameEventThreadQueueStats();
+	}
+	return ThreadQueues[static_cast<int32>(Producer)]->GetStats();
+}
+
+#pragma endregion  "Queue"
+
 #pragma region "Other Event"
 
 bool FGameEventManager::HasEvent(const FEventId& EventId)
 {
-	FScopeLock Lock(&CriticalSection);
-
-	return EventMap.Contains(EventId);
+	return FindListenerCount(EventId.GetHandle()) != INDEX_NONE;
 }
 
 int32 FGameEventManager::GetEventListenerCount(const FEventId& EventId)
 {
-	FScopeLock Lock(&CriticalSection);
+	return FMath::Max(FindListenerCount(EventId.GetHandle()), 0);
+}
+
+int32 FGameEventManager::FindListenerCount(const FGameEventHandle EventHandle)
+{
+	int32 Count = INDEX_NONE;
+	if (ListenerCounts.TryGet(EventHandle, Count))
+	{
+		return Count;
+	}
+
+	// Handles the wait-free table cannot hold are answered by the shard
+	FEventShard& Shard = GetShard(EventHandle);
+	FScopeLock Lock(&Shard.CriticalSection);
+
+	const int32 EventIndex = Shard.Events.Find(EventHandle);
+	return EventIndex != INDEX_NONE ? Shard.Events.NumListeners(EventIndex) : INDEX_NONE;
+}
+
+TArray<FGameEventPriorityBucket> FGameEventManager::GetEventListenerCountsByPriority(const FEventId& EventId)
+{
+	TArray<FGameEventPriorityBucket> Buckets;
+
+	const FGameEventHandle EventHandle = EventId.GetHandle();
+	FEventShard& Shard = GetShard(EventHandle);
+	FScopeLock Lock(&Shard.CriticalSection);
 
-	if (const FEventContext* EventContext = EventMap.Find(EventId))
+	const int32 EventIndex = Shard.Events.Find(EventHandle);
+	if (EventIndex != INDEX_NONE)
 	{
-		return EventContext->Listeners.Num();
+		Shard.Events.GetPriorityBuckets(EventIndex, Buckets);
 	}
-	return 0;
+	return Buckets;
 }
 
 void FGameEventManager::UnpinEvent(const FEventId& EventId)
 {
-	FScopeLock Lock(&CriticalSection);
+	const FGameEventHandle EventHandle = EventId.GetHandle();
+	FEventShard& Shard = GetShard(EventHandle);
 
-	if (EventMap.Contains(EventId))
+	// Declared before the lock so the payload is released once the lock is dropped
+	FGameEventPinnedPayloadRef PinnedPayload;
+	FScopeLock Lock(&Shard.CriticalSection);
+
+	const int32 EventIndex = Shard.Events.Find(EventHandle);
+	if (EventIndex != INDEX_NONE)
 	{
-		FEventContext& TargetEvent = EventMap[EventId];
+		FGameEventTable::FHotRecord& TargetEvent = Shard.Events.GetHot(EventIndex);
 
 		if (TargetEvent.bPinned)
 		{
 			TargetEvent.bPinned = false;
 
-			// Clean up all parameter contexts
-			for (FPropertyContext& Context : TargetEvent.PropertyContexts)
-			{
-				Context.Clean();
-			}
-			TargetEvent.PropertyContexts.Empty();
+			// Listeners still dispatching from the payload keep it alive until they return
+			Shard.PinnedPayloads.RemoveAndCopyValue(EventHandle, PinnedPayload);
 
 			GES_LOG_DISPLAY(TEXT("Event[%s] - Unpinned"), *EventId.GetName());
 		}
@@ -975,132 +1484,109 @@ void FGameEventManager::UnpinEvent(const FEventId& EventId)
 	}
 }
 
-int32 FGameEventManager::RemoveListenersForReceiverInternal(const UObject* Receiver, const TSet<FEventId>* EventsToProcess)
+int32 FGameEventManager::RemoveListenersForReceiverInternal(const UObject* Receiver, const TSet<FGameEventHandle>* EventsToProcess)
 {
 	if (!Receiver)
 	{
 		return 0;
 	}
 
+	const bool bSpecificEvents = EventsToProcess && EventsToProcess->Num() > 0;
 	int32 TotalRemovedCount = 0;
 	int32 InvalidRemovedCount = 0;
-	TSet<FEventId> EventsToCheck; // Record events that need to be checked
 
-	// If specific events to process are specified, only process those events
-	if (EventsToProcess && EventsToProcess->Num() > 0)
+	// Take the receiver's entries out of the receiver index first.
+	// The receiver lock is released before any shard lock is taken, so the two lock domains never nest in this order.
+	TMap<FGameEventHandle, TArray<FGameEventListenerHandle>> EventsToCheck; // Listeners to remove from each event
 	{
-		for (const FEventId& EventId : *EventsToProcess)
+		FScopeLock ReceiverLock(&ReceiverCriticalSection);
+
+		const FObjectKey ReceiverKey(Receiver);
+		if (TSet<FListener>* Contexts = ReceiverMap.Find(ReceiverKey))
 		{
-			if (EventMap.Contains(EventId))
+			for (auto It = Contexts->CreateIterator(); It; ++It)
 			{
-				FEventContext& TargetEvent = EventMap[EventId];
-
-				// Iterate backwards to safely remove elements
-				for (int32 i = TargetEvent.Listeners.Num() - 1; i >= 0; --i)
+				const FListener& Context = *It;
+				if (bSpecificEvents && !EventsToProcess->Contains(Context.EventHandle))
 				{
-					const FListenerContext& CurrentListener = TargetEvent.Listeners[i];
-
-					if (!CurrentListener.Receiver.IsValid())
-					{
-						TargetEvent.Listeners.RemoveAt(i);
-						InvalidRemovedCount++;
-						continue;
-					}
-
-					// Remove all listeners matching the receiver
-					if (CurrentListener.Receiver.Get() == Receiver)
-					{
-						// If it's a Lambda listener, remove from Lambda mapping table
-						if (CurrentListener.IsBoundToLambda() && !CurrentListener.FunctionName.IsEmpty())
-						{
-							LambdaListenerMap.Remove(CurrentListener.FunctionName);
-						}
-
-						TargetEvent.Listeners.RemoveAt(i);
-						TotalRemovedCount++;
-						EventsToCheck.Add(EventId);
-					}
+					continue;
 				}
+
+				EventsToCheck.FindOrAdd(Context.EventHandle).Add(Context.ListenerHandle);
+				It.RemoveCurrent();
+			}
+
+			if (Contexts->Num() == 0)
+			{
+				ReceiverMap.Remove(ReceiverKey);
+				GES_LOG_DISPLAY(TEXT("All listeners for receiver [%s] removed, cleaning from mapping table"), *Receiver->GetName());
 			}
 		}
 	}
-	else
+
+	// Explicitly requested events are always scanned, which also cleans up their invalid listeners
+	if (bSpecificEvents)
 	{
-		// Process all events - search through ReceiverMap
-		if (!ReceiverMap.Contains(Receiver))
+		for (const FGameEventHandle& EventHandle : *EventsToProcess)
 		{
-			return 0;
+			EventsToCheck.FindOrAdd(EventHandle);
 		}
+	}
 
-		const TArray<FListener> Contexts = ReceiverMap[Receiver];
+	for (const TPair<FGameEventHandle, TArray<FGameEventListenerHandle>>& EventToCheck : EventsToCheck)
+	{
+		const FGameEventHandle EventHandle = EventToCheck.Key;
+		FEventShard& Shard = GetShard(EventHandle);
+		FScopeLock Lock(&Shard.CriticalSection);
 
-		for (const FListener& Context : Contexts)
+		const int32 EventIndex = Shard.Events.Find(EventHandle);
+		if (EventIndex == INDEX_NONE)
 		{
-			if (EventMap.Contains(Context.EventId))
-			{
-				FEventContext& TargetEvent = EventMap[Context.EventId];
+			continue;
+		}
+		const int32 OriginalListenerCount = Shard.Events.NumListeners(EventIndex);
 
-				for (int32 i = TargetEvent.Listeners.Num() - 1; i >= 0; --i)
-				{
-					FListenerContext& CurrentListener = TargetEvent.Listeners[i];
-
-					if (CurrentListener.Receiver.Get() == Receiver && CurrentListener.FunctionName == Context.Listener.FunctionName)
-					{
-						// If it's a Lambda listener, remove from Lambda mapping table
-						if (CurrentListener.IsBoundToLambda() && !CurrentListener.FunctionName.IsEmpty())
-						{
-							LambdaListenerMap.Remove(CurrentListener.FunctionName);
-						}
-
-						TargetEvent.Listeners.RemoveAt(i);
-						TotalRemovedCount++;
-						EventsToCheck.Add(Context.EventId);
-						break;
-					}
-				}
+		for (const FGameEventListenerHandle ListenerHandle : EventToCheck.Value)
+		{
+			// The receiver entries are already gone, only the event and the pool still hold the listener
+			if (const FGameEventListenerPool::FEntry* Entry = Shard.Listeners.Find(ListenerHandle))
+			{
+				Shard.Events.RemoveListener(EventIndex, Entry->Key);
+				Shard.Listeners.Remove(ListenerHandle);
+				TotalRemovedCount++;
 			}
 		}
-	}
 
-	// Update ReceiverMap
-	if (EventsToProcess && EventsToProcess->Num() > 0)
-	{
-		// Only remove mappings for specified events
-		if (TArray<FListener>* Contexts = ReceiverMap.Find(Receiver))
+		if (bSpecificEvents && EventsToProcess->Contains(EventHandle))
 		{
-			for (int32 j = Contexts->Num() - 1; j >= 0; --j)
+			TArray<FGameEventListenerHandle> InvalidListeners;
+			Shard.Events.RemoveListenersIf(EventIndex, [&Shard](const FGameEventListenerHandle ListenerHandle)
 			{
-				const FListener& Context = (*Contexts)[j];
-				if (EventsToProcess->Contains(Context.EventId))
-				{
-					Contexts->RemoveAt(j);
-				}
-			}
+				const FGameEventListenerPool::FEntry* Entry = Shard.Listeners.Find(ListenerHandle);
+				return !Entry || !Entry->Listener->Receiver.IsValid();
+			}, InvalidListeners);
 
-			if (Contexts->Num() == 0)
+			for (const FGameEventListenerHandle ListenerHandle : InvalidListeners)
 			{
-				ReceiverMap.Remove(Receiver);
-				GES_LOG_DISPLAY(TEXT("All listeners for receiver [%s] removed, cleaning from mapping table"), *Receiver->GetName());
+				ReleaseListener(Shard, ListenerHandle);
 			}
+			InvalidRemovedCount += InvalidListeners.Num();
 		}
-	}
-	else
-	{
-		// Remove all mappings
-		ReceiverMap.Remove(Receiver);
-	}
 
-	// Check and delete events with no listeners
-	for (const FEventId& EventId : EventsToCheck)
-	{
-		if (EventMap.Contains(EventId))
+		if (Shard.Events.NumListeners(EventIndex) == OriginalListenerCount)
 		{
-			FEventContext& TargetEvent = EventMap[EventId];
-			if (TargetEvent.Listeners.Num() == 0 && !TargetEvent.bPinned)
-			{
-				EventMap.Remove(EventId);
-				GES_LOG_DISPLAY(TEXT("Event[%s] - No listeners remaining after receiver cleanup, event deleted"), *EventId.GetName());
-			}
+			continue;
+		}
+
+		// Check and delete events with no listeners, republish the others
+		if (Shard.Events.NumListeners(EventIndex) == 0 && !Shard.Events.GetHot(EventIndex).bPinned)
+		{
+			GES_LOG_DISPLAY(TEXT("Event[%s] - No listeners remaining after receiver cleanup, event deleted"), *Shard.Events.GetEvent(EventIndex).EventId.GetName());
+			RemoveEvent(Shard, EventIndex);
+		}
+		else
+		{
+			PublishEvent(Shard, EventIndex);
 		}
 	}
 
@@ -1119,8 +1605,6 @@ void FGameEventManager::RemoveAllListenersForReceiver(const UObject* Receiver)
 		return;
 	}
 
-	FScopeLock Lock(&CriticalSection);
-
 	int32 RemovedCount = RemoveListenersForReceiverInternal(Receiver, nullptr);
 
 	if (RemovedCount > 0)
@@ -1129,33 +1613,242 @@ void FGameEventManager::RemoveAllListenersForReceiver(const UObject* Receiver)
 	}
 }
 
-void FGameEventManager::CreateEvent(const FEventId& EventId, const bool bPinned)
+int32 FGameEventManager::PurgeDeadReceivers()
+{
+	int32 NumDeadReceivers = 0;
+	int32 NumDeadListeners = 0;
+	{
+		FScopeLock ReceiverLock(&ReceiverCriticalSection);
+
+		// One pass over the receiver index finds every receiver the collection destroyed
+		for (auto It = ReceiverMap.CreateIterator(); It; ++It)
+		{
+			if (It.Key().ResolveObjectPtr())
+			{
+				continue;
+			}
+
+			for (const FListener& Context : It.Value())
+			{
+				PendingPurge.Add(Context);
+			}
+			NumDeadListeners += It.Value().Num();
+			++NumDeadReceivers;
+			It.RemoveCurrent();
+		}
+	}
+
+	if (NumDeadReceivers > 0)
+	{
+		GES_LOG_DISPLAY(TEXT("GameEventManager:PurgeDeadReceivers, %d dead receivers with %d listeners scheduled for removal"), NumDeadReceivers, NumDeadListeners);
+		ProcessPendingPurge();
+	}
+
+	return NumDeadReceivers;
+}
+
+int32 FGameEventManager::ProcessPendingPurge()
 {
-	FScopeLock Lock(&CriticalSection);
+	TArray<FListener> Batch;
+	{
+		FScopeLock ReceiverLock(&ReceiverCriticalSection);
+		if (PendingPurge.Num() == 0)
+		{
+			return 0;
+		}
 
-	if (EventMap.Contains(EventId))
+		const UGameEventSystemSettings* Settings = UGameEventSystemSettings::Get();
+		const int32 Budget = Settings ? Settings->MaxPurgedListenersPerFrame : 0;
+		const int32 NumToPurge = Budget > 0 ? FMath::Min(Budget, PendingPurge.Num()) : PendingPurge.Num();
+
+		// The order of the purge does not matter, take from the end so the rest of the list stays in place
+		const int32 FirstToPurge = PendingPurge.Num() - NumToPurge;
+		Batch.Append(PendingPurge.GetData() + FirstToPurge, NumToPurge);
+		PendingPurge.SetNum(FirstToPurge);
+	}
+
+	// Group by event so each record is locked, compacted and republished once for the whole batch
+	Batch.Sort([](const FListener& A, const FListener& B)
 	{
-		return;
+		return A.EventHandle.Id < B.EventHandle.Id;
+	});
+
+	int32 NumPurged = 0;
+	for (int32 First = 0; First < Batch.Num();)
+	{
+		const FGameEventHandle EventHandle = Batch[First].EventHandle;
+		int32 Last = First + 1;
+		while (Last < Batch.Num() && Batch[Last].EventHandle == EventHandle)
+		{
+			++Last;
+		}
+
+		FEventShard& Shard = GetShard(EventHandle);
+		FScopeLock Lock(&Shard.CriticalSection);
+
+		const int32 EventIndex = Shard.Events.Find(EventHandle);
+		int32 NumRemoved = 0;
+		for (int32 Index = First; Index < Last; ++Index)
+		{
+			// The receiver entries are already gone, only the event and the pool still hold the listener
+			const FGameEventListenerHandle ListenerHandle = Batch[Index].ListenerHandle;
+			if (const FGameEventListenerPool::FEntry* Entry = Shard.Listeners.Find(ListenerHandle))
+			{
+				if (EventIndex != INDEX_NONE)
+				{
+					Shard.Events.RemoveListener(EventIndex, Entry->Key);
+				}
+				Shard.Listeners.Remove(ListenerHandle);
+				++NumRemoved;
+			}
+		}
+
+		if (EventIndex != INDEX_NONE && NumRemoved > 0)
+		{
+			if (Shard.Events.NumListeners(EventIndex) == 0 && !Shard.Events.GetHot(EventIndex).bPinned)
+			{
+				RemoveEvent(Shard, EventIndex);
+			}
+			else
+			{
+				PublishEvent(Shard, EventIndex);
+			}
+		}
+
+		NumPurged += NumRemoved;
+		First = Last;
 	}
 
-	FEventContext NewEvent;
-	NewEvent.EventId = EventId;
-	NewEvent.bPinned = bPinned;
+	INC_DWORD_STAT_BY(STAT_GameEvent_PurgedListeners, NumPurged);
+	GES_LOG_VERY_VERBOSE(TEXT("GameEventManager:ProcessPendingPurge, Removed %d listeners of dead receivers, %d left"), NumPurged, GetPendingPurgeCount());
+	return NumPurged;
+}
+
+int32 FGameEventManager::GetPendingPurgeCount() const
+{
+	FScopeLock ReceiverLock(&ReceiverCriticalSection);
+	return PendingPurge.Num();
+}
+
+FGameEventManager::FEventShard& FGameEventManager::GetShard(const FGameEventHandle EventHandle)
+{
+	return Shards[GetTypeHash(EventHandle) & (NumShards - 1)];
+}
+
+int32 FGameEventManager::CreateEvent(FEventShard& Shard, const FEventId& EventId, const bool bPinned)
+{
+	bool bAdded = false;
+	const int32 EventIndex = Shard.Events.FindOrAdd(EventId, bAdded);
+	if (!bAdded)
+	{
+		return EventIndex;
+	}
 
-	EventMap.Add(EventId, NewEvent);
+	FGameEventTable::FHotRecord& Hot = Shard.Events.GetHot(EventIndex);
+	Hot.bPinned = bPinned;
+	Hot.bWildcard = FGameEventWildcardIndex::IsPattern(EventId.GetName());
+	PublishEvent(Shard, EventIndex);
 
-	GES_LOG_DISPLAY(TEXT("Event[%s] - CreateEvent : %s"), *EventId.GetName(), NewEvent.bPinned ? TEXT("Pinned") : TEXT("Unpinned"));
+	GES_LOG_DISPLAY(TEXT("Event[%s] - CreateEvent : %s"), *EventId.GetName(), bPinned ? TEXT("Pinned") : TEXT("Unpinned"));
+	return EventIndex;
 }
 
 void FGameEventManager::DeleteEvent(const FEventId& EventId)
 {
-	FScopeLock Lock(&CriticalSection);
+	const FGameEventHandle EventHandle = EventId.GetHandle();
+	FEventShard& Shard = GetShard(EventHandle);
+	FScopeLock Lock(&Shard.CriticalSection);
 
-	if (EventMap.Contains(EventId))
+	const int32 EventIndex = Shard.Events.Find(EventHandle);
+	if (EventIndex != INDEX_NONE)
 	{
-		EventMap.Remove(EventId);
+		RemoveEvent(Shard, EventIndex);
 		GES_LOG_DISPLAY(TEXT("Event[%s] - DeletedEvent"), *EventId.GetName());
 	}
 }
 
+void FGameEventManager::PublishEvent(FEventShard& Shard, const int32 EventIndex)
+{
+	const FEventContext& TargetEvent = Shard.Events.GetEvent(EventIndex);
+
+	// Dispatch runs without the shard lock, the snapshot shares the listener records of the pool instead of copying them
+	TSharedRef<FGameEventListenerSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FGameEventListenerSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->Listeners.Reserve(Shard.Events.NumListeners(EventIndex));
+	Shard.Events.ForEachListener(EventIndex, [&Shard, &Snapshot](const FGameEventListenerHandle ListenerHandle)
+	{
+		if (const FGameEventListenerPool::FEntry* Entry = Shard.Listeners.Find(ListenerHandle))
+		{
+			Snapshot->Listeners.Add(Entry->Listener.ToSharedRef());
+		}
+	});
+	Snapshot->Finalize();
+
+	FGameEventTable::FHotRecord& Hot = Shard.Events.GetHot(EventIndex);
+	Hot.ListenerSnapshot = Snapshot;
+	ListenerCounts.Set(TargetEvent.EventId.GetHandle(), Shard.Events.NumListeners(EventIndex));
+
+	if (Hot.bWildcard)
+	{
+		WildcardIndex.SetPatternListeners(TargetEvent.EventId.GetHandle(), Snapshot);
+	}
+}
+
+void FGameEventManager::RemoveEvent(FEventShard& Shard, const int32 EventIndex)
+{
+	const FEventContext& TargetEvent = Shard.Events.GetEvent(EventIndex);
+	const FGameEventHandle EventHandle = TargetEvent.EventId.GetHandle();
+	Shard.Events.ForEachListener(EventIndex, [this, &Shard](const FGameEventListenerHandle ListenerHandle)
+	{
+		ReleaseListener(Shard, ListenerHandle);
+	});
+
+	if (Shard.Events.GetHot(EventIndex).bWildcard)
+	{
+		WildcardIndex.RemovePattern(EventHandle);
+	}
+
+	Shard.Events.Remove(EventIndex);
+	Shard.PinnedPayloads.Remove(EventHandle);
+	ListenerCounts.Set(EventHandle, INDEX_NONE);
+}
+
+void FGameEventManager::ReleaseListener(FEventShard& Shard, const FGameEventListenerHandle ListenerHandle)
+{
+	if (const FGameEventListenerPool::FEntry* Entry = Shard.Listeners.Find(ListenerHandle))
+	{
+		RemoveReceiverEntry(Entry->ReceiverKey, Entry->EventHandle, ListenerHandle);
+		Shard.Listeners.Remove(ListenerHandle);
+	}
+}
+
 #pragma endregion
+
+#pragma region "ScopedListenerHandle"
+
+FGameEventScopedListenerHandle& FGameEventScopedListenerHandle::operator=(FGameEventScopedListenerHandle&& Other)
+{
+	if (this != &Other)
+	{
+		Reset();
+		Manager = MoveTemp(Other.Manager);
+		ListenerHandle = Other.Release();
+	}
+	return *this;
+}
+
+void FGameEventScopedListenerHandle::Reset()
+{
+	if (!ListenerHandle.IsValid())
+	{
+		return;
+	}
+
+	if (const TSharedPtr<FGameEventManager> PinnedManager = Manager.Pin())
+	{
+		PinnedManager->RemoveListener(ListenerHandle);
+	}
+	ListenerHandle.Invalidate();
+	Manager.Reset();
+}
+
+#pragma endregion "ScopedListenerHandle"
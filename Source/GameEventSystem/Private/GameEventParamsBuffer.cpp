@@ -0,0 +1,177 @@
+#include "GameEventParamsBuffer.h"
+#include "GameEventStats.h"
+#include "GameEventTypes.h"
+#include "UObject/UnrealType.h"
+#include <atomic>
+
+namespace GameEventParamsBuffer
+{
+	// Buckets hold 256 bytes up to 32 KB, bigger frames go straight to the heap
+	constexpr int32 MinBucketShift = 8;
+	constexpr int32 NumBuckets = 8;
+	constexpr uint32 PoolAlignment = 16;
+	// Enough for deep re-entrant dispatch without letting a burst pin memory forever
+	constexpr int32 MaxFreePerBucket = 16;
+
+	std::atomic<uint64> NumHeapAllocations {0};
+
+	int32 GetBucketIndex(const int32 Size)
+	{
+		const int32 Shift = FMath::Max<int32>(FMath::CeilLogTwo(static_cast<uint32>(Size)), MinBucketShift);
+		return Shift - MinBucketShift;
+	}
+
+	uint8* HeapAlloc(const SIZE_T Size, const uint32 Alignment)
+	{
+		NumHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+		INC_DWORD_STAT(STAT_GameEvent_ParamsBufferHeapAllocs);
+		return static_cast<uint8*>(FMemory::Malloc(Size, Alignment));
+	}
+
+	struct FThreadPool
+	{
+		uint8* FreeBuffers[NumBuckets][MaxFreePerBucket];
+
+		int32 NumFree[NumBuckets] = {};
+
+		~FThreadPool()
+		{
+			for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+			{
+				for (int32 Index = 0; Index < NumFree[BucketIndex]; ++Index)
+				{
+					FMemory::Free(FreeBuffers[BucketIndex][Index]);
+				}
+			}
+		}
+
+		uint8* Acquire(const int32 BucketIndex)
+		{
+			if (NumFree[BucketIndex] > 0)
+			{
+				return FreeBuffers[BucketIndex][--NumFree[BucketIndex]];
+			}
+			return HeapAlloc(SIZE_T(1) << (BucketIndex + MinBucketShift), PoolAlignment);
+		}
+
+		void Release(const int32 BucketIndex, uint8* Buffer)
+		{
+			if (NumFree[BucketIndex] < MaxFreePerBucket)
+			{
+				FreeBuffers[BucketIndex][NumFree[BucketIndex]++] = Buffer;
+			}
+			else
+			{
+				FMemory::Free(Buffer);
+			}
+		}
+	};
+
+	FThreadPool& GetThreadPool()
+	{
+		thread_local FThreadPool ThreadPool;
+		return ThreadPool;
+	}
+}
+
+uint8* FGameEventParamsBufferPool::Acquire(const int32 Size, const uint32 Alignment)
+{
+	using namespace GameEventParamsBuffer;
+
+	uint8* Buffer;
+	if (Alignment <= PoolAlignment && GetBucketIndex(Size) < NumBuckets)
+	{
+		Buffer = GetThreadPool().Acquire(GetBucketIndex(Size));
+	}
+	else
+	{
+		Buffer = HeapAlloc(Size, Alignment);
+	}
+
+	FMemory::Memzero(Buffer, Size);
+	return Buffer;
+}
+
+void FGameEventParamsBufferPool::Release(uint8* Buffer, const int32 Size, const uint32 Alignment)
+{
+	using namespace GameEventParamsBuffer;
+
+	if (Alignment <= PoolAlignment && GetBucketIndex(Size) < NumBuckets)
+	{
+		GetThreadPool().Release(GetBucketIndex(Size), Buffer);
+	}
+	else
+	{
+		FMemory::Free(Buffer);
+	}
+}
+
+uint64 FGameEventParamsBufferPool::GetNumHeapAllocations()
+{
+	return GameEventParamsBuffer::NumHeapAllocations.load(std::memory_order_relaxed);
+}
+
+FGameEventScopedParamsBuffer::FGameEventScopedParamsBuffer(const int32 InSize, const uint32 InAlignment) : Data(nullptr),
+                                                                                                        Size(InSize),
+                                                                                                        Alignment(FMath::Max<uint32>(InAlignment, 1))
+{
+	if (Size <= 0)
+	{
+		return;
+	}
+
+	if (Size <= InlineSize && Alignment <= InlineAlignment)
+	{
+		Data = InlineData;
+		FMemory::Memzero(Data, Size);
+	}
+	else
+	{
+		Data = FGameEventParamsBufferPool::Acquire(Size, Alignment);
+	}
+}
+
+FGameEventScopedParamsBuffer::~FGameEventScopedParamsBuffer()
+{
+	if (Data && Data != InlineData)
+	{
+		FGameEventParamsBufferPool::Release(Data, Size, Alignment);
+	}
+}
+
+FGameEventDispatchScope::FGameEventDispatchScope(const TArray<FPropertyContext>& PropertyContexts) : PayloadFingerprint(FGameEventFunctionLayout::GetPayloadFingerprint(PropertyContexts))
+{
+}
+
+FGameEventDispatchScope::~FGameEventDispatchScope()
+{
+	for (const FSharedFrame& Frame : SharedFrames)
+	{
+		const FGameEventFunctionLayout& Layout = *Frame.Layout;
+		for (int32 Index = 0; Index < Layout.DestructParams.Num(); ++Index)
+		{
+			Layout.DestructParams[Index]->DestroyValue(Frame.Data + Layout.DestructOffsets[Index]);
+		}
+		FGameEventParamsBufferPool::Release(Frame.Data, Layout.ParmsSize, Layout.MinAlignment);
+	}
+}
+
+uint8* FGameEventDispatchScope::FindSharedFrame(const FGameEventFunctionLayout& Layout) const
+{
+	for (const FSharedFrame& Frame : SharedFrames)
+	{
+		if (Frame.Layout->FrameFingerprint == Layout.FrameFingerprint)
+		{
+			return Frame.Data;
+		}
+	}
+	return nullptr;
+}
+
+uint8* FGameEventDispatchScope::AddSharedFrame(const FGameEventFunctionLayoutPtr& Layout)
+{
+	FSharedFrame& Frame = SharedFrames.AddDefaulted_GetRef();
+	Frame.Layout = Layout;
+	Frame.Data = FGameEventParamsBufferPool::Acquire(Layout->ParmsSize, Layout->MinAlignment);
+	return Frame.Data;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventFunctionLayout.h"
+
+struct FPropertyContext;
+
+/**
+ * Per-thread pool of zeroed parameter buffers in power-of-two buckets.
+ * Frames bigger than the largest bucket or aligned above 16 bytes go to the heap.
+ */
+class FGameEventParamsBufferPool
+{
+public:
+	static uint8* Acquire(const int32 Size, const uint32 Alignment);
+	static void Release(uint8* Buffer, const int32 Size, const uint32 Alignment);
+
+	/** Total heap allocations made for parameter buffers since startup, stays flat once the pools are warm */
+	static uint64 GetNumHeapAllocations();
+};
+
+/**
+ * Zeroed parameter buffer for ProcessEvent-based listeners.
+ * Small frames live on the stack, larger ones come from FGameEventParamsBufferPool,
+ * so the steady-state send path never touches the heap.
+ */
+class FGameEventScopedParamsBuffer
+{
+public:
+	FGameEventScopedParamsBuffer(const int32 InSize, const uint32 InAlignment);
+	~FGameEventScopedParamsBuffer();
+
+	FGameEventScopedParamsBuffer(const FGameEventScopedParamsBuffer&) = delete;
+	FGameEventScopedParamsBuffer& operator=(const FGameEventScopedParamsBuffer&) = delete;
+
+	uint8* GetData() const
+	{
+		return Data;
+	}
+
+private:
+	static constexpr int32 InlineSize = 128;
+	static constexpr uint32 InlineAlignment = 16;
+
+	alignas(InlineAlignment) uint8 InlineData[InlineSize];
+
+	uint8* Data;
+
+	int32 Size;
+
+	uint32 Alignment;
+};
+
+/**
+ * State shared by every listener of one send.
+ * Holds the payload fingerprint and the parameter frames built for listeners that cannot write to their parameters,
+ * so each distinct frame layout is filled from the payload once per send.
+ */
+class FGameEventDispatchScope
+{
+public:
+	explicit FGameEventDispatchScope(const TArray<FPropertyContext>& PropertyContexts);
+	~FGameEventDispatchScope();
+
+	FGameEventDispatchScope(const FGameEventDispatchScope&) = delete;
+	FGameEventDispatchScope& operator=(const FGameEventDispatchScope&) = delete;
+
+	uint64 GetPayloadFingerprint() const
+	{
+		return PayloadFingerprint;
+	}
+
+	/** Frame already filled for a layout with the same FrameFingerprint, nullptr if none was built yet */
+	uint8* FindSharedFrame(const FGameEventFunctionLayout& Layout) const;
+
+	/** Register a new zeroed frame for the layout, the caller fills it */
+	uint8* AddSharedFrame(const FGameEventFunctionLayoutPtr& Layout);
+
+private:
+	struct FSharedFrame
+	{
+		FGameEventFunctionLayoutPtr Layout;
+
+		uint8* Data;
+	};
+
+	TArray<FSharedFrame, TInlineAllocator<4>> SharedFrames;
+
+	uint64 PayloadFingerprint;
+};
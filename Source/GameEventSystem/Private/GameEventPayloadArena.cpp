@@ -0,0 +1,106 @@
+#include "GameEventPayloadArena.h"
+#include "UObject/UnrealType.h"
+#include "Serialization/StructuredArchive.h"
+#include "UObject/GCObject.h"
+
+FGameEventPayloadArena::FGameEventPayloadArena(const SIZE_T InBlockSize) : BlockSize(InBlockSize),
+                                                                          CurrentBlock(0)
+{
+}
+
+FGameEventPayloadArena::~FGameEventPayloadArena()
+{
+	for (const FBlock& Block : Blocks)
+	{
+		FMemory::Free(Block.Data);
+	}
+}
+
+void* FGameEventPayloadArena::Allocate(const SIZE_T Size, const uint32 Alignment)
+{
+	const uint32 SafeAlignment = FMath::Max<uint32>(Alignment, 1);
+
+	for (; CurrentBlock < Blocks.Num(); ++CurrentBlock)
+	{
+		FBlock& Block = Blocks[CurrentBlock];
+		const SIZE_T Offset = Align(Block.Used, SafeAlignment);
+		if (Offset + Size <= Block.Size)
+		{
+			Block.Used = Offset + Size;
+			return Block.Data + Offset;
+		}
+	}
+
+	// Oversized values get a dedicated block, everything else shares the regular block size
+	FBlock& NewBlock = Blocks.AddDefaulted_GetRef();
+	NewBlock.Size = FMath::Max<SIZE_T>(BlockSize, Size + SafeAlignment);
+	NewBlock.Data = static_cast<uint8*>(FMemory::Malloc(NewBlock.Size, FMath::Max<uint32>(SafeAlignment, 16)));
+	NewBlock.Used = Size;
+	CurrentBlock = Blocks.Num() - 1;
+	return NewBlock.Data;
+}
+
+FPropertyContext FGameEventPayloadArena::CopyProperty(const FPropertyContext& Source)
+{
+	FProperty* Property = Source.Property.Get();
+	if (!Property || !Source.PropertyPtr)
+	{
+		return FPropertyContext();
+	}
+
+	void* Dest = Allocate(Property->GetSize(), Property->GetMinAlignment());
+	Property->InitializeValue(Dest);
+	Property->CopyCompleteValue(Dest, Source.PropertyPtr);
+
+	return FPropertyContext(Property, Dest);
+}
+
+void FGameEventPayloadArena::DestroyProperty(const FPropertyContext& Context)
+{
+	if (const FProperty* Property = Context.Property.Get())
+	{
+		if (Context.PropertyPtr)
+		{
+			Property->DestroyValue(Context.PropertyPtr);
+		}
+	}
+}
+
+void FGameEventPayloadArena::AddPropertyReferences(FReferenceCollector& Collector, const FPropertyContext& Context)
+{
+	FProperty* Property = Context.Property.Get();
+	if (!Property || !Context.PropertyPtr)
+	{
+		return;
+	}
+
+	TArray<const FStructProperty*> EncounteredStructProps;
+	if (!Property->ContainsObjectReference(EncounteredStructProps))
+	{
+		return;
+	}
+
+	// Walks any value type, objects nested in structs and containers included, weak references stay weak
+	FArchive& Archive = Collector.GetVerySlowReferenceCollectorArchive();
+	FStructuredArchiveFromArchive StructuredArchive(Archive);
+	Property->SerializeItem(StructuredArchive.GetSlot(), Context.PropertyPtr, nullptr);
+}
+
+void FGameEventPayloadArena::Reset()
+{
+	for (FBlock& Block : Blocks)
+	{
+		Block.Used = 0;
+	}
+	CurrentBlock = 0;
+}
+
+SIZE_T FGameEventPayloadArena::GetAllocatedSize() const
+{
+	SIZE_T TotalSize = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		TotalSize += Block.Size;
+	}
+	return TotalSize;
+}
@@ -0,0 +1,335 @@
+#include "GameEventPayloadPredicate.h"
+#include "Logger.h"
+#include "UObject/UnrealType.h"
+
+void FListenerContext::SetPayloadPredicates(const TArray<FGameEventPayloadPredicate>& Predicates)
+{
+	if (Predicates.Num() == 0)
+	{
+		PayloadPredicate.Reset();
+	}
+	else
+	{
+		PayloadPredicate = MakeShared<const FGameEventCompiledPredicate, ESPMode::ThreadSafe>(Predicates);
+	}
+}
+
+FGameEventCompiledPredicate::FGameEventCompiledPredicate(const TArray<FGameEventPayloadPredicate>& InPredicates) : Predicates(InPredicates)
+{
+}
+
+bool FGameEventCompiledPredicate::Evaluate(const TArray<FPropertyContext>& PropertyContexts, const uint64 PayloadFingerprint, const UObject* Receiver) const
+{
+	const FProgram* Program = LastProgram.load(std::memory_order_acquire);
+	if (!Program || Program->PayloadFingerprint != PayloadFingerprint)
+	{
+		Program = &FindOrCompile(PropertyContexts, PayloadFingerprint, Receiver);
+	}
+
+	if (!Program->bValid)
+	{
+		return false;
+	}
+
+	for (const FCondition& Condition : Program->Conditions)
+	{
+		if (!Test(Condition, PropertyContexts, Receiver))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+const FGameEventCompiledPredicate::FProgram& FGameEventCompiledPredicate::FindOrCompile(const TArray<FPropertyContext>& PropertyContexts, const uint64 PayloadFingerprint, const UObject* Receiver) const
+{
+	FScopeLock Lock(&ProgramCriticalSection);
+
+	for (const TUniquePtr<FProgram>& Program : Programs)
+	{
+		if (Program->PayloadFingerprint == PayloadFingerprint)
+		{
+			LastProgram.store(Program.Get(), std::memory_order_release);
+			return *Program;
+		}
+	}
+
+	TUniquePtr<FProgram> Program = MakeUnique<FProgram>();
+	Program->PayloadFingerprint = PayloadFingerprint;
+	for (const FGameEventPayloadPredicate& Predicate : Predicates)
+	{
+		FCondition& Condition = Program->Conditions.AddDefaulted_GetRef();
+		if (!Compile(Predicate, PropertyContexts, Receiver, Condition))
+		{
+			GES_LOG_WARNING(TEXT("GameEventCompiledPredicate:Compile, Predicate on parameter %d field '%s' does not apply to this payload, the listener is skipped for it"),
+			                Predicate.ParameterIndex,
+			                *Predicate.FieldPath);
+			Program->bValid = false;
+			Program->Conditions.Reset();
+			break;
+		}
+	}
+
+	const FProgram& Compiled = *Program;
+	Programs.Add(MoveTemp(Program));
+	LastProgram.store(&Compiled, std::memory_order_release);
+	return Compiled;
+}
+
+bool FGameEventCompiledPredicate::Compile(const FGameEventPayloadPredicate& Predicate, const TArray<FPropertyContext>& PropertyContexts, const UObject* Receiver, FCondition& OutCondition) const
+{
+	if (!PropertyContexts.IsValidIndex(Predicate.ParameterIndex) || !PropertyContexts[Predicate.ParameterIndex].IsValid())
+	{
+		return false;
+	}
+
+	OutCondition.Op = Predicate.Op;
+	OutCondition.Field.ParameterIndex = Predicate.ParameterIndex;
+	if (!ResolvePath(PropertyContexts[Predicate.ParameterIndex].Property.Get(), nullptr, Predicate.FieldPath, OutCondition.Field))
+	{
+		return false;
+	}
+
+	const FProperty* Leaf = OutCondition.Field.Leaf;
+	const bool bOrdered = Predicate.Op != EGameEventPredicateOp::Equal && Predicate.Op != EGameEventPredicateOp::NotEqual;
+
+	if (!Predicate.ReceiverFieldPath.IsEmpty())
+	{
+		if (!Receiver || !ResolvePath(nullptr, Receiver->GetClass(), Predicate.ReceiverFieldPath, OutCondition.ReceiverField))
+		{
+			return false;
+		}
+		OutCondition.bAgainstReceiver = true;
+
+		double Unused = 0.0;
+		const bool bNumbers = ReadNumber(Leaf, nullptr, Unused) && ReadNumber(OutCondition.ReceiverField.Leaf, nullptr, Unused);
+		if (bNumbers)
+		{
+			OutCondition.Kind = EValueKind::Number;
+			return true;
+		}
+
+		// Anything else compares by value, which needs both fields to be of the same type
+		OutCondition.Kind = EValueKind::Identical;
+		return !bOrdered && Leaf->SameType(OutCondition.ReceiverField.Leaf);
+	}
+
+	double Unused = 0.0;
+	if (ReadNumber(Leaf, nullptr, Unused))
+	{
+		OutCondition.Kind = EValueKind::Number;
+
+		const UEnum* Enum = nullptr;
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Leaf))
+		{
+			Enum = EnumProperty->GetEnum();
+		}
+		else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Leaf))
+		{
+			Enum = ByteProperty->Enum;
+		}
+
+		const int64 EnumValue = Enum ? Enum->GetValueByNameString(Predicate.Value) : INDEX_NONE;
+		if (EnumValue != INDEX_NONE)
+		{
+			OutCondition.Number = static_cast<double>(EnumValue);
+		}
+		else if (CastField<FBoolProperty>(Leaf) && !Predicate.Value.IsNumeric())
+		{
+			OutCondition.Number = Predicate.Value.ToBool() ? 1.0 : 0.0;
+		}
+		else if (!LexTryParseString(OutCondition.Number, *Predicate.Value))
+		{
+			return false;
+		}
+		return true;
+	}
+
+	if (CastField<FStrProperty>(Leaf))
+	{
+		OutCondition.Kind = EValueKind::String;
+		OutCondition.String = Predicate.Value;
+		return true;
+	}
+
+	if (CastField<FNameProperty>(Leaf))
+	{
+		OutCondition.Kind = EValueKind::Name;
+		OutCondition.Name = FName(*Predicate.Value);
+		return !bOrdered;
+	}
+
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Leaf);
+	if (StructProperty && StructProperty->Struct == FGameplayTag::StaticStruct())
+	{
+		OutCondition.Kind = EValueKind::Tag;
+		OutCondition.Tag = FGameplayTag::RequestGameplayTag(FName(*Predicate.Value), false);
+		return !bOrdered;
+	}
+
+	return false;
+}
+
+bool FGameEventCompiledPredicate::ResolvePath(const FProperty* Root, const UStruct* RootStruct, const FString& Path, FFieldAccess& OutAccess)
+{
+	TArray<FString> Segments;
+	Path.ParseIntoArray(Segments, TEXT("."), true);
+
+	const FProperty* Current = Root;
+	const UStruct* Container = RootStruct;
+	for (const FString& Segment : Segments)
+	{
+		FStep Step;
+		if (Current)
+		{
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Current))
+			{
+				Container = StructProperty->Struct;
+			}
+			else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Current))
+			{
+				Container = ObjectProperty->PropertyClass;
+				Step.Dereference = ObjectProperty;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		const FProperty* Field = Container ? FindFProperty<FProperty>(Container, FName(*Segment)) : nullptr;
+		if (!Field)
+		{
+			return false;
+		}
+
+		Step.Offset = Field->GetOffset_ForInternal();
+		OutAccess.Steps.Add(Step);
+		Current = Field;
+	}
+
+	OutAccess.Leaf = Current;
+	return Current != nullptr;
+}
+
+const void* FGameEventCompiledPredicate::Walk(const FFieldAccess& Access, const TArray<FPropertyContext>& PropertyContexts, const UObject* Receiver)
+{
+	const uint8* Cursor = Access.ParameterIndex != INDEX_NONE
+			? static_cast<const uint8*>(PropertyContexts[Access.ParameterIndex].PropertyPtr)
+			: reinterpret_cast<const uint8*>(Receiver);
+
+	for (const FStep& Step : Access.Steps)
+	{
+		if (!Cursor)
+		{
+			return nullptr;
+		}
+		if (Step.Dereference)
+		{
+			Cursor = reinterpret_cast<const uint8*>(Step.Dereference->GetObjectPropertyValue(Cursor));
+			if (!Cursor)
+			{
+				return nullptr;
+			}
+		}
+		Cursor += Step.Offset;
+	}
+	return Cursor;
+}
+
+bool FGameEventCompiledPredicate::ReadNumber(const FProperty* Leaf, const void* Value, double& OutNumber)
+{
+	// Called with a null Value at compile time to ask whether the field is a number
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Leaf))
+	{
+		Leaf = EnumProperty->GetUnderlyingProperty();
+	}
+
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Leaf))
+	{
+		if (Value)
+		{
+			OutNumber = NumericProperty->IsFloatingPoint()
+					? NumericProperty->GetFloatingPointPropertyValue(Value)
+					: static_cast<double>(NumericProperty->GetSignedIntPropertyValue(Value));
+		}
+		return true;
+	}
+
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Leaf))
+	{
+		if (Value)
+		{
+			OutNumber = BoolProperty->GetPropertyValue(Value) ? 1.0 : 0.0;
+		}
+		return true;
+	}
+
+	return false;
+}
+
+bool FGameEventCompiledPredicate::Test(const FCondition& Condition, const TArray<FPropertyContext>& PropertyContexts, const UObject* Receiver)
+{
+	const void* Value = Walk(Condition.Field, PropertyContexts, Receiver);
+	if (!Value)
+	{
+		return false;
+	}
+
+	const void* ReceiverValue = nullptr;
+	if (Condition.bAgainstReceiver)
+	{
+		ReceiverValue = Walk(Condition.ReceiverField, PropertyContexts, Receiver);
+		if (!ReceiverValue)
+		{
+			return false;
+		}
+	}
+
+	// Order of the field against the operand: negative, zero or positive
+	int32 Order = 0;
+	switch (Condition.Kind)
+	{
+	case EValueKind::Number:
+		{
+			double Number = 0.0;
+			double Operand = Condition.Number;
+			ReadNumber(Condition.Field.Leaf, Value, Number);
+			if (ReceiverValue)
+			{
+				ReadNumber(Condition.ReceiverField.Leaf, ReceiverValue, Operand);
+			}
+			Order = Number < Operand ? -1 : (Number > Operand ? 1 : 0);
+			break;
+		}
+	case EValueKind::String:
+		Order = static_cast<const FString*>(Value)->Compare(Condition.String);
+		break;
+	case EValueKind::Name:
+		Order = *static_cast<const FName*>(Value) == Condition.Name ? 0 : 1;
+		break;
+	case EValueKind::Tag:
+		Order = *static_cast<const FGameplayTag*>(Value) == Condition.Tag ? 0 : 1;
+		break;
+	case EValueKind::Identical:
+		Order = Condition.Field.Leaf->Identical(Value, ReceiverValue) ? 0 : 1;
+		break;
+	}
+
+	switch (Condition.Op)
+	{
+	case EGameEventPredicateOp::Equal:
+		return Order == 0;
+	case EGameEventPredicateOp::NotEqual:
+		return Order != 0;
+	case EGameEventPredicateOp::Less:
+		return Order < 0;
+	case EGameEventPredicateOp::LessOrEqual:
+		return Order <= 0;
+	case EGameEventPredicateOp::Greater:
+		return Order > 0;
+	case EGameEventPredicateOp::GreaterOrEqual:
+		return Order >= 0;
+	}
+	return false;
+}
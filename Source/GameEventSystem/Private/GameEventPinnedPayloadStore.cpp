@@ -0,0 +1,216 @@
+#include "GameEventPinnedPayloadStore.h"
+#include "GameEventPayloadArena.h"
+#include "UObject/UnrealType.h"
+
+static_assert(sizeof(FGameEventPinnedPayload) <= 64, "Pinned payload header must fit in HeaderSize");
+
+FGameEventPinnedPayload::FGameEventPinnedPayload(FGameEventPinnedPayloadStore& InStore, const int32 InSizeClass, const SIZE_T InValuesSize) : RefCount(0),
+                                                                                                                                           Store(InStore),
+                                                                                                                                           SizeClass(InSizeClass),
+                                                                                                                                           ValuesSize(InValuesSize),
+                                                                                                                                           PrevLive(nullptr),
+                                                                                                                                           NextLive(nullptr)
+{
+}
+
+FGameEventPinnedPayload::~FGameEventPinnedPayload()
+{
+	for (const FPropertyContext& Context : PropertyContexts)
+	{
+		if (const FProperty* Property = Context.Property.Get())
+		{
+			if (Context.PropertyPtr)
+			{
+				Property->DestroyValue(Context.PropertyPtr);
+			}
+		}
+	}
+}
+
+void FGameEventPinnedPayload::AddValue(FProperty* Property, void* Value)
+{
+	// The garbage collector may be walking the values of the live payloads
+	FScopeLock Lock(&Store.CriticalSection);
+	PropertyContexts.Add(FPropertyContext(Property, Value));
+}
+
+uint32 FGameEventPinnedPayload::Release() const
+{
+	const int32 NewRefCount = RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+	if (NewRefCount == 0)
+	{
+		Store.Free(const_cast<FGameEventPinnedPayload*>(this));
+	}
+	return static_cast<uint32>(NewRefCount);
+}
+
+FGameEventPinnedPayloadStore::FGameEventPinnedPayloadStore() : LivePayloads(nullptr),
+                                                               BlockCursor(nullptr),
+                                                               BlockEnd(nullptr),
+                                                               NumPayloads(0)
+{
+	for (void*& FreeList : FreeLists)
+	{
+		FreeList = nullptr;
+	}
+}
+
+FGameEventPinnedPayloadStore::~FGameEventPinnedPayloadStore()
+{
+	ensureMsgf(NumPayloads.load() == 0, TEXT("%d pinned payloads are still referenced"), NumPayloads.load());
+
+	for (uint8* Block : Blocks)
+	{
+		FMemory::Free(Block);
+	}
+}
+
+FGameEventPinnedPayloadRef FGameEventPinnedPayloadStore::Copy(const TArray<FPropertyContext>& Source)
+{
+	SIZE_T ValuesSize = 0;
+	for (const FPropertyContext& Context : Source)
+	{
+		if (const FProperty* Property = Context.Property.Get())
+		{
+			ValuesSize = Align(ValuesSize, FMath::Max<SIZE_T>(Property->GetMinAlignment(), 1)) + Property->GetSize();
+		}
+	}
+
+	FGameEventPinnedPayloadRef Payload = Allocate(ValuesSize);
+
+	SIZE_T Offset = 0;
+	for (const FPropertyContext& Context : Source)
+	{
+		FProperty* Property = Context.Property.Get();
+		if (!Property || !Context.PropertyPtr)
+		{
+			continue;
+		}
+
+		Offset = Align(Offset, FMath::Max<SIZE_T>(Property->GetMinAlignment(), 1));
+		void* Dest = Payload->GetValues() + Offset;
+		Property->InitializeValue(Dest);
+		Property->CopyCompleteValue(Dest, Context.PropertyPtr);
+		Payload->AddValue(Property, Dest);
+		Offset += Property->GetSize();
+	}
+
+	return Payload;
+}
+
+FGameEventPinnedPayloadRef FGameEventPinnedPayloadStore::Allocate(const SIZE_T ValuesSize)
+{
+	const SIZE_T TotalSize = FGameEventPinnedPayload::HeaderSize + ValuesSize;
+	const int32 SizeClass = GetSizeClass(TotalSize);
+
+	FScopeLock Lock(&CriticalSection);
+
+	void* Memory = nullptr;
+	if (SizeClass == INDEX_NONE)
+	{
+		Memory = FMemory::Malloc(TotalSize, 16);
+	}
+	else
+	{
+		if (void* FreeChunk = FreeLists[SizeClass])
+		{
+			// A free chunk stores the next free chunk of its class in its first bytes
+			FreeLists[SizeClass] = *static_cast<void**>(FreeChunk);
+			Memory = FreeChunk;
+		}
+		else
+		{
+			const SIZE_T ChunkSize = SIZE_T(1) << (MinSizeClassShift + SizeClass);
+			if (!BlockCursor || BlockCursor + ChunkSize > BlockEnd)
+			{
+				// The tail of the previous block is too small for this class and is left unused
+				uint8* Block = static_cast<uint8*>(FMemory::Malloc(BlockSize, 16));
+				Blocks.Add(Block);
+				BlockCursor = Block;
+				BlockEnd = Block + BlockSize;
+			}
+			Memory = BlockCursor;
+			BlockCursor += ChunkSize;
+		}
+	}
+
+	FGameEventPinnedPayload* Payload = new(Memory) FGameEventPinnedPayload(*this, SizeClass, ValuesSize);
+	Payload->NextLive = LivePayloads;
+	if (LivePayloads)
+	{
+		LivePayloads->PrevLive = Payload;
+	}
+	LivePayloads = Payload;
+
+	NumPayloads.fetch_add(1, std::memory_order_relaxed);
+	return FGameEventPinnedPayloadRef(Payload);
+}
+
+void FGameEventPinnedPayloadStore::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	FScopeLock Lock(&CriticalSection);
+	for (const FGameEventPinnedPayload* Payload = LivePayloads; Payload; Payload = Payload->NextLive)
+	{
+		for (const FPropertyContext& Context : Payload->PropertyContexts)
+		{
+			FGameEventPayloadArena::AddPropertyReferences(Collector, Context);
+		}
+	}
+}
+
+FString FGameEventPinnedPayloadStore::GetReferencerName() const
+{
+	return TEXT("FGameEventPinnedPayloadStore");
+}
+
+SIZE_T FGameEventPinnedPayloadStore::GetAllocatedSize() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return static_cast<SIZE_T>(Blocks.Num()) * BlockSize;
+}
+
+int32 FGameEventPinnedPayloadStore::GetSizeClass(const SIZE_T Size)
+{
+	for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+	{
+		if (Size <= (SIZE_T(1) << (MinSizeClassShift + SizeClass)))
+		{
+			return SizeClass;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FGameEventPinnedPayloadStore::Free(FGameEventPinnedPayload* Payload)
+{
+	{
+		// Unlinked before its values are destroyed, the garbage collector must not see them half torn down
+		FScopeLock Lock(&CriticalSection);
+		if (Payload->PrevLive)
+		{
+			Payload->PrevLive->NextLive = Payload->NextLive;
+		}
+		else
+		{
+			LivePayloads = Payload->NextLive;
+		}
+		if (Payload->NextLive)
+		{
+			Payload->NextLive->PrevLive = Payload->PrevLive;
+		}
+	}
+
+	const int32 SizeClass = Payload->SizeClass;
+	Payload->~FGameEventPinnedPayload();
+	NumPayloads.fetch_sub(1, std::memory_order_relaxed);
+
+	if (SizeClass == INDEX_NONE)
+	{
+		FMemory::Free(Payload);
+		return;
+	}
+
+	FScopeLock Lock(&CriticalSection);
+	*reinterpret_cast<void**>(Payload) = FreeLists[SizeClass];
+	FreeLists[SizeClass] = Payload;
+}
@@ -0,0 +1,90 @@
+#include "GameEventPropertyHelper.h"
+#include "GameEventTypes.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+
+FGameEventPropertyCache& FGameEventPropertyCache::Get()
+{
+	static FGameEventPropertyCache Instance;
+	return Instance;
+}
+
+FGameEventPropertyCache::FGameEventPropertyCache() : Owner(nullptr),
+                                                     Generation(1)
+{
+}
+
+FGameEventPropertyCache::~FGameEventPropertyCache()
+{
+	Reset();
+
+	// The process-wide cache is destroyed after the object system at exit, the owner is gone with it then
+	if (Owner && UObjectInitialized())
+	{
+		Owner->RemoveFromRoot();
+	}
+}
+
+int32 FGameEventPropertyCache::Num() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return Properties.Num();
+}
+
+int32 FGameEventPropertyCache::NumLinked() const
+{
+	FScopeLock Lock(&CriticalSection);
+
+	int32 NumLinked = 0;
+	for (const FField* Field = Owner ? Owner->ChildProperties : nullptr; Field; Field = Field->Next)
+	{
+		++NumLinked;
+	}
+	return NumLinked;
+}
+
+void FGameEventPropertyCache::Reset()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	GES_LOG_VERY_VERBOSE(TEXT("GameEventPropertyCache:Reset, Releasing %d cached properties"), Properties.Num());
+
+	// Properties constructed with an owner struct are linked into its ChildProperties, unlink them before deleting
+	if (Owner && UObjectInitialized())
+	{
+		FField** Link = &Owner->ChildProperties;
+		while (*Link)
+		{
+			FField* Field = *Link;
+			if (Properties.Contains(static_cast<FProperty*>(Field)))
+			{
+				*Link = Field->Next;
+				Field->Next = nullptr;
+			}
+			else
+			{
+				Link = &Field->Next;
+			}
+		}
+	}
+
+	for (const FProperty* Property : Properties)
+	{
+		delete Property;
+	}
+	Properties.Reset();
+	Generation.fetch_add(1, std::memory_order_release);
+}
+
+FFieldVariant FGameEventPropertyCache::GetOwner()
+{
+	if (!Owner)
+	{
+		// Properties may be created on any thread, keep the collector out while the owner is not rooted yet
+		FGCScopeGuard GCGuard;
+		const FName OwnerName = MakeUniqueObjectName(GetTransientPackage(), UScriptStruct::StaticClass(), TEXT("GameEventPropertyCacheOwner"));
+		Owner = NewObject<UScriptStruct>(GetTransientPackage(), OwnerName, RF_Transient);
+		Owner->AddToRoot();
+	}
+	return FFieldVariant(Owner);
+}
@@ -0,0 +1,400 @@
+#include "GameEventQueue.h"
+#include "GameEventStats.h"
+#include "Logger.h"
+#include "HAL/PlatformTime.h"
+
+FGameEventQueue::FGameEventQueue() : bFlushing(false),
+                                     WriteIndex(0),
+                                     NumBacklogged(0)
+{
+}
+
+FGameEventQueue::~FGameEventQueue()
+{
+	Reset();
+}
+
+void FGameEventQueue::Enqueue(const FEventContext& EventContext)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	FBuffer& Buffer = Buffers[WriteIndex];
+
+	// Queued events are kept until the flush, so their names are interned like listened ones
+	const FGameEventHandle EventHandle = EventContext.EventId.FindOrAddHandle();
+	const bool bCoalesce = CoalescingEvents.Contains(EventHandle);
+
+	if (bCoalesce)
+	{
+		if (const int32* PendingIndex = Buffer.CoalescedEvents.Find(EventHandle))
+		{
+			FEventContext& PendingEvent = Buffer.Events[*PendingIndex];
+			Buffer.WorldContexts[*PendingIndex] = EventContext.WorldContext;
+			PendingEvent.bPinned = EventContext.bPinned;
+
+			if (!TryOverwritePayload(PendingEvent, EventContext.PropertyContexts))
+			{
+				// The payload layout changed, the old values are dropped and the arena memory is reclaimed on flush
+				for (const FPropertyContext& PropertyContext : PendingEvent.PropertyContexts)
+				{
+					FGameEventPayloadArena::DestroyProperty(PropertyContext);
+				}
+				PendingEvent.PropertyContexts.Reset();
+				CopyPayload(Buffer, PendingEvent, EventContext.PropertyContexts);
+			}
+
+			GES_LOG_VERY_VERBOSE(TEXT("Event[%s] - Coalesced into the pending queued send"), *EventContext.EventId.GetName());
+			return;
+		}
+	}
+
+	const int32 EventIndex = Buffer.Events.AddDefaulted();
+	FEventContext& QueuedEvent = Buffer.Events[EventIndex];
+	QueuedEvent.EventId = EventContext.EventId;
+	QueuedEvent.bPinned = EventContext.bPinned;
+	CopyPayload(Buffer, QueuedEvent, EventContext.PropertyContexts);
+	Buffer.WorldContexts.Add(EventContext.WorldContext);
+
+	const EGameEventLane* Lane = EventLanes.Find(EventHandle);
+	Buffer.Lanes.Add(Lane ? *Lane : EGameEventLane::Gameplay);
+	Buffer.EnqueueSeconds.Add(FPlatformTime::Seconds());
+
+	if (bCoalesce)
+	{
+		Buffer.CoalescedEvents.Add(EventHandle, EventIndex);
+	}
+}
+
+int32 FGameEventQueue::Flush(TFunctionRef<void(const FEventContext&)> Dispatch)
+{
+	FScopeLock FlushLock(&FlushCriticalSection);
+
+	// Sent by a listener of this flush, the pending events wait for the next flush like the ones queued meanwhile
+	if (bFlushing)
+	{
+		GES_LOG_VERY_VERBOSE(TEXT("GameEventQueue:Flush, Called during a flush, deferred to the next one"));
+		return 0;
+	}
+	TGuardValue<bool> FlushingGuard(bFlushing, true);
+
+	int32 ReadIndex;
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (Buffers[WriteIndex].Events.Num() == 0 && NumBacklogged.load(std::memory_order_relaxed) == 0)
+		{
+			return 0;
+		}
+		ReadIndex = WriteIndex;
+		WriteIndex ^= 1;
+	}
+
+	FBuffer& Buffer = Buffers[ReadIndex];
+
+	// Lane by lane, grouped by event so each listener snapshot is walked while it is hot
+	TArray<int32> Order;
+	Order.Reserve(Buffer.Events.Num());
+	for (int32 EventIndex = 0; EventIndex < Buffer.Events.Num(); ++EventIndex)
+	{
+		Order.Add(EventIndex);
+	}
+	Order.StableSort([&Buffer](const int32 A, const int32 B)
+	{
+		if (Buffer.Lanes[A] != Buffer.Lanes[B])
+		{
+			return Buffer.Lanes[A] < Buffer.Lanes[B];
+		}
+		return Buffer.Events[A].EventId.GetHandle().Id < Buffer.Events[B].EventId.GetHandle().Id;
+	});
+
+	const double FlushSeconds = FPlatformTime::Seconds();
+	int32 NumDelivered = 0;
+	int32 NumCarriedOver = 0;
+	int32 NextOrder = 0;
+	for (int32 LaneIndex = 0; LaneIndex < static_cast<int32>(EGameEventLane::Count); ++LaneIndex)
+	{
+		FLane& Lane = Lanes[LaneIndex];
+		Lane.LastFlushMaxLatencySeconds = 0.0;
+		Lane.OldestBackloggedSeconds = 0.0;
+
+		const double LaneStartSeconds = FPlatformTime::Seconds();
+		const double BudgetSeconds = Lane.Config.BudgetMicroseconds * 1.0e-6;
+		const double MaxLatencySeconds = Lane.Config.MaxLatencyMilliseconds * 1.0e-3;
+
+		// Time only moves forward, once over budget the rest of the lane is
+		bool bOverBudget = false;
+		const auto IsOverBudget = [&bOverBudget, BudgetSeconds, LaneStartSeconds]()
+		{
+			bOverBudget = bOverBudget || (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - LaneStartSeconds >= BudgetSeconds);
+			return bOverBudget;
+		};
+		const auto Deliver = [&Lane, &NumDelivered, &Dispatch, FlushSeconds, MaxLatencySeconds](const FEventContext& QueuedEvent, const double EnqueueSeconds, const bool bOverBudget)
+		{
+			const double LatencySeconds = FlushSeconds - EnqueueSeconds;
+			if (bOverBudget)
+			{
+				// Sends of one event are backlogged oldest first, so forcing the overdue ones out keeps their order
+				if (MaxLatencySeconds <= 0.0 || LatencySeconds < MaxLatencySeconds)
+				{
+					return false;
+				}
+				++Lane.NumForced;
+			}
+
+			Dispatch(QueuedEvent);
+			++Lane.NumDelivered;
+			++NumDelivered;
+			Lane.TotalLatencySeconds += LatencySeconds;
+			Lane.LastFlushMaxLatencySeconds = FMath::Max(Lane.LastFlushMaxLatencySeconds, LatencySeconds);
+			return true;
+		};
+
+		// Carried over sends are older than this flush's, they go first
+		int32 NumKept = 0;
+		for (int32 BacklogIndex = 0; BacklogIndex < Lane.Backlog.Num(); ++BacklogIndex)
+		{
+			FBacklogEvent& Pending = Lane.Backlog[BacklogIndex];
+			if (Pending.WorldContext.IsStale())
+			{
+				GES_LOG_WARNING(TEXT("Event[%s] - World context destroyed while the queued send was backlogged, dropped"), *Pending.Event.EventId.GetName());
+				continue;
+			}
+
+			// A coalesced send queued since this one was carried over replaces it, keeping its wait for the max latency
+			if (const int32* NewerIndex = Buffer.CoalescedEvents.Find(Pending.Event.EventId.GetHandle()))
+			{
+				Buffer.EnqueueSeconds[*NewerIndex] = FMath::Min(Buffer.EnqueueSeconds[*NewerIndex], Pending.EnqueueSeconds);
+				GES_LOG_VERY_VERBOSE(TEXT("Event[%s] - Backlogged send coalesced into the newer queued send"), *Pending.Event.EventId.GetName());
+				continue;
+			}
+
+			Pending.Event.WorldContext = Pending.WorldContext.Get();
+			if (Deliver(Pending.Event, Pending.EnqueueSeconds, IsOverBudget()))
+			{
+				continue;
+			}
+
+			Lane.OldestBackloggedSeconds = FMath::Max(Lane.OldestBackloggedSeconds, FlushSeconds - Pending.EnqueueSeconds);
+			if (NumKept != BacklogIndex)
+			{
+				Lane.Backlog[NumKept] = MoveTemp(Pending);
+			}
+			++NumKept;
+		}
+		NumBacklogged.fetch_sub(Lane.Backlog.Num() - NumKept, std::memory_order_relaxed);
+		Lane.Backlog.SetNum(NumKept);
+
+		for (; NextOrder < Order.Num() && static_cast<int32>(Buffer.Lanes[Order[NextOrder]]) == LaneIndex; ++NextOrder)
+		{
+			const int32 EventIndex = Order[NextOrder];
+			FEventContext& QueuedEvent = Buffer.Events[EventIndex];
+			const TWeakObjectPtr<UObject>& WorldContext = Buffer.WorldContexts[EventIndex];
+			if (WorldContext.IsStale())
+			{
+				GES_LOG_WARNING(TEXT("Event[%s] - World context destroyed while the send was queued, dropped"), *QueuedEvent.EventId.GetName());
+				continue;
+			}
+
+			QueuedEvent.WorldContext = WorldContext.Get();
+			if (!Deliver(QueuedEvent, Buffer.EnqueueSeconds[EventIndex], IsOverBudget()))
+			{
+				CarryOver(Lane, QueuedEvent, WorldContext, Buffer.EnqueueSeconds[EventIndex]);
+				Lane.OldestBackloggedSeconds = FMath::Max(Lane.OldestBackloggedSeconds, FlushSeconds - Buffer.EnqueueSeconds[EventIndex]);
+				++NumCarriedOver;
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_GameEvent_QueueCarriedOver, NumCarriedOver);
+	GES_LOG_VERY_VERBOSE(TEXT("GameEventQueue:Flush, Delivered %d queued events, %d carried over"), NumDelivered, NumCarriedOver);
+
+	ResetBuffer(Buffer);
+	return NumDelivered;
+}
+
+int32 FGameEventQueue::Num() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return Buffers[WriteIndex].Events.Num() + NumBacklogged.load(std::memory_order_relaxed);
+}
+
+void FGameEventQueue::SetLaneConfig(const EGameEventLane Lane, const FGameEventLaneConfig& Config)
+{
+	if (Lane >= EGameEventLane::Count)
+	{
+		return;
+	}
+
+	FScopeLock FlushLock(&FlushCriticalSection);
+	Lanes[static_cast<int32>(Lane)].Config = Config;
+}
+
+void FGameEventQueue::SetEventLane(const FGameEventHandle EventHandle, const EGameEventLane Lane)
+{
+	FScopeLock Lock(&CriticalSection);
+	if (Lane == EGameEventLane::Gameplay)
+	{
+		EventLanes.Remove(EventHandle);
+	}
+	else if (Lane < EGameEventLane::Count)
+	{
+		EventLanes.Add(EventHandle, Lane);
+	}
+}
+
+EGameEventLane FGameEventQueue::GetEventLane(const FGameEventHandle EventHandle) const
+{
+	FScopeLock Lock(&CriticalSection);
+	const EGameEventLane* Lane = EventLanes.Find(EventHandle);
+	return Lane ? *Lane : EGameEventLane::Gameplay;
+}
+
+FGameEventLaneStats FGameEventQueue::GetLaneStats(const EGameEventLane Lane) const
+{
+	FGameEventLaneStats Stats;
+	if (Lane >= EGameEventLane::Count)
+	{
+		return Stats;
+	}
+
+	FScopeLock FlushLock(&FlushCriticalSection);
+	const FLane& LaneState = Lanes[static_cast<int32>(Lane)];
+	Stats.NumBacklogged = LaneState.Backlog.Num();
+	Stats.NumDelivered = LaneState.NumDelivered;
+	Stats.NumCarriedOver = LaneState.NumCarriedOver;
+	Stats.NumForced = LaneState.NumForced;
+	Stats.AverageLatencySeconds = LaneState.NumDelivered > 0 ? LaneState.TotalLatencySeconds / LaneState.NumDelivered : 0.0;
+	Stats.LastFlushMaxLatencySeconds = LaneState.LastFlushMaxLatencySeconds;
+	Stats.OldestBackloggedSeconds = LaneState.OldestBackloggedSeconds;
+	return Stats;
+}
+
+void FGameEventQueue::SetCoalescing(const FGameEventHandle EventHandle, const bool bCoalesce)
+{
+	FScopeLock Lock(&CriticalSection);
+	if (bCoalesce)
+	{
+		CoalescingEvents.Add(EventHandle);
+	}
+	else
+	{
+		CoalescingEvents.Remove(EventHandle);
+		// Sends already pending stay queued, later sends are appended again
+		Buffers[WriteIndex].CoalescedEvents.Remove(EventHandle);
+	}
+}
+
+bool FGameEventQueue::IsCoalescing(const FGameEventHandle EventHandle) const
+{
+	FScopeLock Lock(&CriticalSection);
+	return CoalescingEvents.Contains(EventHandle);
+}
+
+void FGameEventQueue::Reset()
+{
+	FScopeLock FlushLock(&FlushCriticalSection);
+	FScopeLock Lock(&CriticalSection);
+
+	for (FBuffer& Buffer : Buffers)
+	{
+		ResetBuffer(Buffer);
+	}
+	for (FLane& Lane : Lanes)
+	{
+		Lane.Backlog.Empty();
+	}
+	NumBacklogged.store(0, std::memory_order_relaxed);
+}
+
+void FGameEventQueue::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	// Flushes run on the game thread, which the collector holds, so only the write buffer can change meanwhile.
+	// The flush lock is not taken, a listener that collects garbage during a flush holds it. Backlogged payloads are
+	// reported by BacklogStore
+	FScopeLock Lock(&CriticalSection);
+
+	for (const FBuffer& Buffer : Buffers)
+	{
+		for (const FEventContext& QueuedEvent : Buffer.Events)
+		{
+			for (const FPropertyContext& PropertyContext : QueuedEvent.PropertyContexts)
+			{
+				FGameEventPayloadArena::AddPropertyReferences(Collector, PropertyContext);
+			}
+		}
+	}
+}
+
+FString FGameEventQueue::GetReferencerName() const
+{
+	return TEXT("FGameEventQueue");
+}
+
+void FGameEventQueue::CarryOver(FLane& Lane, const FEventContext& QueuedEvent, const TWeakObjectPtr<UObject>& WorldContext, const double EnqueueSeconds)
+{
+	// The arena is rewound after this flush, the values move to a payload that lives as long as the backlog entry
+	FBacklogEvent& Pending = Lane.Backlog.AddDefaulted_GetRef();
+	Pending.Event.EventId = QueuedEvent.EventId;
+	Pending.Event.bPinned = QueuedEvent.bPinned;
+	Pending.WorldContext = WorldContext;
+	Pending.EnqueueSeconds = EnqueueSeconds;
+	if (QueuedEvent.PropertyContexts.Num() > 0)
+	{
+		Pending.Payload = BacklogStore.Copy(QueuedEvent.PropertyContexts);
+		Pending.Event.PropertyContexts = Pending.Payload->GetPropertyContexts();
+	}
+
+	++Lane.NumCarriedOver;
+	NumBacklogged.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FGameEventQueue::CopyPayload(FBuffer& Buffer, FEventContext& QueuedEvent, const TArray<FPropertyContext>& Source)
+{
+	QueuedEvent.PropertyContexts.Reserve(Source.Num());
+	for (const FPropertyContext& PropertyContext : Source)
+	{
+		QueuedEvent.PropertyContexts.Add(Buffer.Arena.CopyProperty(PropertyContext));
+	}
+}
+
+bool FGameEventQueue::TryOverwritePayload(FEventContext& QueuedEvent, const TArray<FPropertyContext>& Source)
+{
+	if (QueuedEvent.PropertyContexts.Num() != Source.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Source.Num(); ++Index)
+	{
+		const FProperty* PendingProperty = QueuedEvent.PropertyContexts[Index].Property.Get();
+		const FProperty* SourceProperty = Source[Index].Property.Get();
+		if (!PendingProperty || !SourceProperty || !Source[Index].PropertyPtr || !PendingProperty->SameType(SourceProperty))
+		{
+			return false;
+		}
+	}
+
+	// Same layout, copy the new values over the existing slot
+	for (int32 Index = 0; Index < Source.Num(); ++Index)
+	{
+		const FPropertyContext& PendingContext = QueuedEvent.PropertyContexts[Index];
+		PendingContext.Property->CopyCompleteValue(PendingContext.PropertyPtr, Source[Index].PropertyPtr);
+	}
+	return true;
+}
+
+void FGameEventQueue::ResetBuffer(FBuffer& Buffer)
+{
+	for (const FEventContext& QueuedEvent : Buffer.Events)
+	{
+		for (const FPropertyContext& PropertyContext : QueuedEvent.PropertyContexts)
+		{
+			FGameEventPayloadArena::DestroyProperty(PropertyContext);
+		}
+	}
+	Buffer.Events.Reset();
+	Buffer.CoalescedEvents.Reset();
+	Buffer.EnqueueSeconds.Reset();
+	Buffer.Lanes.Reset();
+	Buffer.WorldContexts.Reset();
+	Buffer.Arena.Reset();
+}
@@ -0,0 +1,82 @@
+#include "GameEventQueueTicker.h"
+#include "GameEventManager.h"
+#include "GameEventSystemSettings.h"
+#include "GameEventWorldSubsystem.h"
+#include "Engine/World.h"
+
+FGameEventQueueTicker::FGameEventQueueTicker() : LastGlobalFlushFrame(MAX_uint64)
+{
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(this, &FGameEventQueueTicker::OnWorldTickStart);
+	WorldPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FGameEventQueueTicker::OnWorldPostActorTick);
+}
+
+FGameEventQueueTicker::~FGameEventQueueTicker()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(WorldPostActorTickHandle);
+}
+
+void FGameEventQueueTicker::Tick(float DeltaTime)
+{
+	FlushAt(EGameEventQueueFlushPoint::EndOfFrame);
+
+	// Listeners of dead receivers left over by the last garbage collection are purged a budget per frame
+	if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get())
+	{
+		Manager->ProcessPendingPurge();
+	}
+}
+
+ETickableTickType FGameEventQueueTicker::GetTickableTickType() const
+{
+	return ETickableTickType::Always;
+}
+
+bool FGameEventQueueTicker::IsTickableWhenPaused() const
+{
+	return true;
+}
+
+bool FGameEventQueueTicker::IsTickableInEditor() const
+{
+	return true;
+}
+
+TStatId FGameEventQueueTicker::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FGameEventQueueTicker, STATGROUP_Tickables);
+}
+
+void FGameEventQueueTicker::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	FlushAt(EGameEventQueueFlushPoint::WorldTickStart, World);
+}
+
+void FGameEventQueueTicker::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	FlushAt(EGameEventQueueFlushPoint::PostActorTick, World);
+}
+
+void FGameEventQueueTicker::FlushAt(const EGameEventQueueFlushPoint FlushPoint, const UWorld* World)
+{
+	const UGameEventSystemSettings* Settings = UGameEventSystemSettings::Get();
+	if (!Settings || Settings->QueueFlushPoint != FlushPoint)
+	{
+		return;
+	}
+
+	// Every ticking world reaches its flush point, the global queue only needs the first of them this frame
+	if (LastGlobalFlushFrame != GFrameCounter)
+	{
+		LastGlobalFlushFrame = GFrameCounter;
+		if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get())
+		{
+			Manager->FlushQueuedEvents();
+		}
+	}
+
+	if (const TSharedPtr<FGameEventManager> WorldManager = UGameEventWorldSubsystem::FindEventManager(World))
+	{
+		WorldManager->FlushQueuedEvents();
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Engine/EngineBaseTypes.h"
+
+enum class EGameEventQueueFlushPoint : uint8;
+
+/**
+ * Flushes the GameEventManager queue once per frame at the flush point chosen in UGameEventSystemSettings.
+ * The world flush points come from FWorldDelegates, EndOfFrame uses the tickable object tick.
+ * The tickable object tick also continues the purge of dead receivers started after garbage collection.
+ * The world flush points also flush the bus of the ticking world, UGameEventWorldSubsystem handles its own EndOfFrame.
+ * World delegates fire for every ticking world, the global queue is only flushed by the first of them each frame.
+ */
+class FGameEventQueueTicker : public FTickableGameObject
+{
+public:
+	FGameEventQueueTicker();
+	virtual ~FGameEventQueueTicker() override;
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual bool IsTickableInEditor() const override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+private:
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	void FlushAt(const EGameEventQueueFlushPoint FlushPoint, const UWorld* World = nullptr);
+
+	// GFrameCounter of the last flush of the global queue
+	uint64 LastGlobalFlushFrame;
+
+	FDelegateHandle WorldTickStartHandle;
+
+	FDelegateHandle WorldPostActorTickHandle;
+};
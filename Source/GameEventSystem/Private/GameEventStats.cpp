@@ -0,0 +1,6 @@
+#include "GameEventStats.h"
+
+DEFINE_STAT(STAT_GameEvent_ParamsBufferHeapAllocs);
+DEFINE_STAT(STAT_GameEvent_SendsWithNoListeners);
+DEFINE_STAT(STAT_GameEvent_PurgedListeners);
+DEFINE_STAT(STAT_GameEvent_QueueCarriedOver);
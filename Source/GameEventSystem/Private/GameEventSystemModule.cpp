@@ -1,7 +1,9 @@
 #include "GameEventSystemModule.h"
 #include "GameEventManager.h"
+#include "GameEventQueueTicker.h"
 #include "GameEventSystemSettings.h"
 #include "Logger.h"
+#include "UObject/UObjectGlobals.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -31,6 +33,17 @@ void FGameEventSystemModule::StartupModule()
 		GES_LOG_ERROR(TEXT("Failed to initialize GameEventManager instance"));
 	}
 
+	QueueTicker = MakeShared<FGameEventQueueTicker>();
+
+	// Listeners of receivers destroyed by the collection are purged in one batch instead of being skipped on every send
+	PostGarbageCollectDelegate = FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([]()
+	{
+		if (const TSharedPtr<FGameEventManager> Manager = FGameEventManager::Get())
+		{
+			Manager->PurgeDeadReceivers();
+		}
+	});
+
 #if WITH_EDITOR
 	BeginPieDelegate = FEditorDelegates::BeginPIE.AddLambda([](bool bIsSimulating)
 	{
@@ -58,6 +71,10 @@ void FGameEventSystemModule::ShutdownModule()
 {
 	GES_LOG_VERY_VERBOSE(TEXT("GameEventSystem module is shutting down..."));
 
+	QueueTicker.Reset();
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectDelegate);
+
 	const TSharedPtr<FGameEventManager> EventManager = FGameEventManager::Get();
 	if (EventManager.IsValid())
 	{
@@ -65,6 +82,9 @@ void FGameEventSystemModule::ShutdownModule()
 		GES_LOG_VERY_VERBOSE(TEXT("Cleanup completed"));
 	}
 
+	// Every payload referencing a cached property was released by Clear
+	FGameEventPropertyCache::Get().Reset();
+
 #if WITH_EDITOR
 	if (BeginPieDelegate.IsValid())
 	{
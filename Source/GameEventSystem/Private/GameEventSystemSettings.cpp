@@ -2,8 +2,23 @@
 #include "Logger.h"
 
 UGameEventSystemSettings::UGameEventSystemSettings() : bEnableDebug(true),
-                                                       bEnableNodeDebug(false)
+                                                       bEnableNodeDebug(false),
+                                                       QueueFlushPoint(EGameEventQueueFlushPoint::PostActorTick),
+                                                       bPerWorldEventBuses(false),
+                                                       MaxPurgedListenersPerFrame(1024)
 {
+	for (uint8 Producer = 0; Producer < static_cast<uint8>(EGameEventProducer::Count); ++Producer)
+	{
+		ProducerQueues.Add(static_cast<EGameEventProducer>(Producer));
+	}
+	// Loading threads must not lose events, they can afford to wait for the game thread
+	ProducerQueues[EGameEventProducer::Loading].OverflowPolicy = EGameEventOverflowPolicy::Block;
+
+	// No budgets by default, every queued event is delivered by the next flush
+	for (uint8 Lane = 0; Lane < static_cast<uint8>(EGameEventLane::Count); ++Lane)
+	{
+		QueueLanes.Add(static_cast<EGameEventLane>(Lane));
+	}
 }
 
 FText UGameEventSystemSettings::GetSectionText() const
@@ -15,7 +30,7 @@ FText UGameEventSystemSettings::GetSectionDescription() const
 {
 	return NSLOCTEXT("GameEventSystemSettings",
 	                 "SectionDescription",
-	                 "Configure logging settings for the Game Event System plugin");
+	                 "Configure logging and event queue settings for the Game Event System plugin");
 }
 
 #if WITH_EDITOR
@@ -0,0 +1,252 @@
+#include "GameEventTable.h"
+#include "Algo/BinarySearch.h"
+
+FGameEventTable::FGameEventTable() : SlotMask(0),
+                                     SlotShift(32),
+                                     NumLive(0),
+                                     NumTombstones(0)
+{
+}
+
+int32 FGameEventTable::Find(const FGameEventHandle EventHandle) const
+{
+	// Only live records have a slot, removed events leave a tombstone
+	const int32 SlotIndex = FindSlot(EventHandle.Id);
+	return SlotIndex != INDEX_NONE ? Slots[SlotIndex].Index : INDEX_NONE;
+}
+
+int32 FGameEventTable::FindOrAdd(const FEventId& EventId, bool& bOutAdded)
+{
+	const FGameEventHandle EventHandle = EventId.GetHandle();
+	bOutAdded = false;
+
+	const int32 SlotIndex = FindSlot(EventHandle.Id);
+	if (SlotIndex != INDEX_NONE)
+	{
+		return Slots[SlotIndex].Index;
+	}
+
+	// Keep live slots and tombstones under 3/4 of the slots so probe sequences stay short.
+	// Double if the live events alone fill half of the slots, otherwise dropping the tombstones makes enough room
+	if ((NumLive + NumTombstones + 1) * 4 > Slots.Num() * 3)
+	{
+		Rehash((NumLive + 1) * 2 > Slots.Num() ? FMath::Max(Slots.Num() * 2, 16) : Slots.Num());
+	}
+
+	// A dead record of any event is revived before a new one is added, it still has its listener capacity
+	int32 Index = INDEX_NONE;
+	if (FreeRecords.Num() > 0)
+	{
+		Index = FreeRecords.Pop();
+	}
+	else
+	{
+		Index = Events.AddDefaulted();
+		HotRecords.AddDefaulted();
+		ListenerIndices.AddDefaulted();
+	}
+
+	// The first tombstone on the probe sequence is reused, the handle is known not to be further along it
+	uint32 Probe = GetHomeSlot(EventHandle.Id);
+	while (Slots[Probe].HandleId != 0 && Slots[Probe].HandleId != TombstoneId)
+	{
+		Probe = (Probe + 1) & SlotMask;
+	}
+	if (Slots[Probe].HandleId == TombstoneId)
+	{
+		--NumTombstones;
+	}
+	Slots[Probe].HandleId = EventHandle.Id;
+	Slots[Probe].Index = Index;
+
+	FEventContext& Event = Events[Index];
+	Event.EventId = EventId;
+	HotRecords[Index].bLive = true;
+	++NumLive;
+	bOutAdded = true;
+	return Index;
+}
+
+void FGameEventTable::Remove(const int32 Index)
+{
+	FHotRecord& Hot = HotRecords[Index];
+	if (!Hot.bLive)
+	{
+		return;
+	}
+
+	const int32 SlotIndex = FindSlot(Events[Index].EventId.GetHandle().Id);
+	if (SlotIndex != INDEX_NONE)
+	{
+		Slots[SlotIndex].HandleId = TombstoneId;
+		Slots[SlotIndex].Index = INDEX_NONE;
+		++NumTombstones;
+	}
+	FreeRecords.Add(Index);
+
+	Hot.bLive = false;
+	Hot.bPinned = false;
+	Hot.bWildcard = false;
+	Hot.ListenerSnapshot.Reset();
+
+	// Reset keeps the allocations for the next event using the record
+	FEventContext& Event = Events[Index];
+	ListenerIndices[Index].Positions.Reset();
+	ListenerIndices[Index].Buckets.Reset();
+	ListenerIndices[Index].NumListeners = 0;
+	Event.PropertyContexts.Reset();
+	Event.WorldContext = nullptr;
+	Event.SpecificTarget = nullptr;
+	--NumLive;
+
+	// Tombstones lengthen every probe crossing them, rehash in place once they take a quarter of the slots
+	if (NumTombstones * 4 > Slots.Num())
+	{
+		Rehash(Slots.Num());
+	}
+}
+
+void FGameEventTable::AddListener(const int32 Index, const FGameEventListenerKey& Key, const FGameEventListenerHandle ListenerHandle, const int32 Priority)
+{
+	FListenerIndex& Indices = ListenerIndices[Index];
+
+	// First bucket of an equal or lower priority, a new bucket goes in its place
+	const int32 BucketIndex = Algo::LowerBoundBy(Indices.Buckets, Priority, &FBucket::Priority, TGreater<int32>());
+	if (!Indices.Buckets.IsValidIndex(BucketIndex) || Indices.Buckets[BucketIndex].Priority != Priority)
+	{
+		FBucket NewBucket;
+		NewBucket.Priority = Priority;
+		Indices.Buckets.Insert(MoveTemp(NewBucket), BucketIndex);
+	}
+
+	FBucket& Bucket = Indices.Buckets[BucketIndex];
+	FListenerPosition Position;
+	Position.Priority = Priority;
+	Position.Index = Bucket.Listeners.Add(ListenerHandle);
+	Bucket.Keys.Add(Key);
+	Indices.Positions.Add(Key, Position);
+	++Indices.NumListeners;
+}
+
+FGameEventListenerHandle FGameEventTable::FindListener(const int32 Index, const FGameEventListenerKey& Key) const
+{
+	const FListenerIndex& Indices = ListenerIndices[Index];
+	const FListenerPosition* Position = Indices.Positions.Find(Key);
+	if (!Position)
+	{
+		return FGameEventListenerHandle();
+	}
+	return Indices.Buckets[FindBucket(Indices, Position->Priority)].Listeners[Position->Index];
+}
+
+FGameEventListenerHandle FGameEventTable::RemoveListener(const int32 Index, const FGameEventListenerKey& Key)
+{
+	FListenerIndex& Indices = ListenerIndices[Index];
+	const FListenerPosition* Position = Indices.Positions.Find(Key);
+	if (!Position)
+	{
+		return FGameEventListenerHandle();
+	}
+	return RemoveFromBucket(Indices, FindBucket(Indices, Position->Priority), Position->Index);
+}
+
+void FGameEventTable::GetPriorityBuckets(const int32 Index, TArray<FGameEventPriorityBucket>& OutBuckets) const
+{
+	OutBuckets.Reset();
+
+	for (const FBucket& Bucket : ListenerIndices[Index].Buckets)
+	{
+		FGameEventPriorityBucket& PriorityBucket = OutBuckets.AddDefaulted_GetRef();
+		PriorityBucket.Priority = Bucket.Priority;
+		PriorityBucket.NumListeners = Bucket.Listeners.Num();
+	}
+}
+
+void FGameEventTable::Empty()
+{
+	Slots.Empty();
+	SlotMask = 0;
+	SlotShift = 32;
+	HotRecords.Empty();
+	Events.Empty();
+	ListenerIndices.Empty();
+	FreeRecords.Empty();
+	NumLive = 0;
+	NumTombstones = 0;
+}
+
+int32 FGameEventTable::FindBucket(const FListenerIndex& Indices, const int32 Priority)
+{
+	// Few distinct priorities per event, the search is over a handful of buckets
+	const int32 BucketIndex = Algo::LowerBoundBy(Indices.Buckets, Priority, &FBucket::Priority, TGreater<int32>());
+	return Indices.Buckets.IsValidIndex(BucketIndex) && Indices.Buckets[BucketIndex].Priority == Priority ? BucketIndex : INDEX_NONE;
+}
+
+FGameEventListenerHandle FGameEventTable::RemoveFromBucket(FListenerIndex& Indices, const int32 BucketIndex, const int32 ListenerIndex)
+{
+	FBucket& Bucket = Indices.Buckets[BucketIndex];
+	const FGameEventListenerHandle ListenerHandle = Bucket.Listeners[ListenerIndex];
+	Indices.Positions.Remove(Bucket.Keys[ListenerIndex]);
+
+	// The last listener of the bucket fills the hole, it is the only one whose position changes
+	Bucket.Listeners.RemoveAtSwap(ListenerIndex);
+	Bucket.Keys.RemoveAtSwap(ListenerIndex);
+	if (ListenerIndex < Bucket.Keys.Num())
+	{
+		Indices.Positions[Bucket.Keys[ListenerIndex]].Index = ListenerIndex;
+	}
+	--Indices.NumListeners;
+
+	if (Bucket.Listeners.Num() == 0)
+	{
+		Indices.Buckets.RemoveAt(BucketIndex);
+	}
+	return ListenerHandle;
+}
+
+int32 FGameEventTable::FindSlot(const uint32 HandleId) const
+{
+	if (Slots.Num() == 0 || HandleId == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	for (uint32 Probe = GetHomeSlot(HandleId);; Probe = (Probe + 1) & SlotMask)
+	{
+		const FSlot& Slot = Slots[Probe];
+		if (Slot.HandleId == HandleId)
+		{
+			return static_cast<int32>(Probe);
+		}
+		if (Slot.HandleId == 0)
+		{
+			return INDEX_NONE;
+		}
+	}
+}
+
+void FGameEventTable::Rehash(const int32 NewNumSlots)
+{
+	TArray<FSlot> OldSlots = MoveTemp(Slots);
+
+	Slots.SetNum(NewNumSlots);
+	SlotMask = static_cast<uint32>(NewNumSlots - 1);
+	SlotShift = 32 - FMath::FloorLog2(static_cast<uint32>(NewNumSlots));
+	NumTombstones = 0;
+
+	// Records never move, only the slots of the live ones are rehashed
+	for (const FSlot& OldSlot : OldSlots)
+	{
+		if (OldSlot.HandleId == 0 || OldSlot.HandleId == TombstoneId)
+		{
+			continue;
+		}
+
+		uint32 Probe = GetHomeSlot(OldSlot.HandleId);
+		while (Slots[Probe].HandleId != 0)
+		{
+			Probe = (Probe + 1) & SlotMask;
+		}
+		Slots[Probe] = OldSlot;
+	}
+}
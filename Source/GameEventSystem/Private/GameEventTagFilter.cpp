@@ -0,0 +1,217 @@
+#include "GameEventTypes.h"
+#include "GameplayTagContainer.h"
+#include "UObject/UnrealType.h"
+
+namespace GameEventTagFilter
+{
+	/** Tag sets of a filter once its query is folded in */
+	struct FCompiledFilter
+	{
+		TArray<FGameplayTag> AnyTags;
+		TArray<FGameplayTag> AllTags;
+		TArray<FGameplayTag> IgnoreTags;
+	};
+
+	static bool CompileExpression(const FGameplayTagQueryExpression& Expression, FCompiledFilter& Compiled)
+	{
+		switch (Expression.ExprType)
+		{
+		case EGameplayTagQueryExprType::AnyTagsMatch:
+			// A second any-of set cannot share the single any mask of a row
+			if (Compiled.AnyTags.Num() > 0 || Expression.TagSet.Num() == 0)
+			{
+				return false;
+			}
+			Compiled.AnyTags = Expression.TagSet;
+			return true;
+		case EGameplayTagQueryExprType::AllTagsMatch:
+			Compiled.AllTags.Append(Expression.TagSet);
+			return true;
+		case EGameplayTagQueryExprType::NoTagsMatch:
+			Compiled.IgnoreTags.Append(Expression.TagSet);
+			return true;
+		case EGameplayTagQueryExprType::AllExprMatch:
+			for (const FGameplayTagQueryExpression& Child : Expression.ExprSet)
+			{
+				if (!CompileExpression(Child, Compiled))
+				{
+					return false;
+				}
+			}
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/** @return false if the query has to be evaluated per listener, Compiled is left untouched then */
+	static bool CompileQuery(const FGameplayTagQuery& Query, FCompiledFilter& Compiled)
+	{
+		FGameplayTagQueryExpression Expression;
+		Query.GetQueryExpr(Expression);
+
+		FCompiledFilter WithQuery = Compiled;
+		if (!CompileExpression(Expression, WithQuery))
+		{
+			return false;
+		}
+		Compiled = MoveTemp(WithQuery);
+		return true;
+	}
+}
+
+void FGameEventTagFilterTable::Build(const TConstArrayView<FListenerRecord> Listeners)
+{
+	using namespace GameEventTagFilter;
+
+	Tags.Reset();
+	AnyMasks.Reset();
+	AllMasks.Reset();
+	IgnoreMasks.Reset();
+	QueryFallbacks.Reset();
+	NumWords = 0;
+	NumListeners = 0;
+
+	bool bHasFilter = false;
+	for (const FListenerRecord& Listener : Listeners)
+	{
+		bHasFilter |= Listener->TagFilter.IsValid();
+	}
+	if (!bHasFilter)
+	{
+		return;
+	}
+
+	// Compile every filter first, the row width depends on the number of distinct tags
+	TArray<FCompiledFilter> Compiled;
+	Compiled.SetNum(Listeners.Num());
+	TMap<FGameplayTag, int32> TagBits;
+	for (int32 ListenerIndex = 0; ListenerIndex < Listeners.Num(); ++ListenerIndex)
+	{
+		const FGameEventTagFilter* Filter = Listeners[ListenerIndex]->TagFilter.Get();
+		if (!Filter)
+		{
+			continue;
+		}
+
+		FCompiledFilter& Entry = Compiled[ListenerIndex];
+		Entry.AnyTags = Filter->RequireAnyTags.GetGameplayTagArray();
+		Entry.AllTags = Filter->RequireAllTags.GetGameplayTagArray();
+		Entry.IgnoreTags = Filter->IgnoreTags.GetGameplayTagArray();
+		if (!Filter->TagQuery.IsEmpty() && !CompileQuery(Filter->TagQuery, Entry))
+		{
+			QueryFallbacks.Emplace(ListenerIndex, &Filter->TagQuery);
+		}
+
+		const auto AssignBits = [this, &TagBits](const TArray<FGameplayTag>& TagSet)
+		{
+			for (const FGameplayTag& Tag : TagSet)
+			{
+				if (!TagBits.Contains(Tag))
+				{
+					TagBits.Add(Tag, Tags.Add(Tag));
+				}
+			}
+		};
+		AssignBits(Entry.AnyTags);
+		AssignBits(Entry.AllTags);
+		AssignBits(Entry.IgnoreTags);
+	}
+
+	NumListeners = Listeners.Num();
+	NumWords = FMath::Max(FMath::DivideAndRoundUp(Tags.Num(), 64), 1);
+	AnyMasks.SetNumZeroed(NumListeners * NumWords);
+	AllMasks.SetNumZeroed(NumListeners * NumWords);
+	IgnoreMasks.SetNumZeroed(NumListeners * NumWords);
+
+	for (int32 ListenerIndex = 0; ListenerIndex < NumListeners; ++ListenerIndex)
+	{
+		const int32 Row = ListenerIndex * NumWords;
+		const auto SetBits = [&TagBits, Row](const TArray<FGameplayTag>& TagSet, TArray<uint64>& Masks)
+		{
+			for (const FGameplayTag& Tag : TagSet)
+			{
+				const int32 Bit = TagBits.FindChecked(Tag);
+				Masks[Row + (Bit >> 6)] |= 1ull << (Bit & 63);
+			}
+		};
+		SetBits(Compiled[ListenerIndex].AnyTags, AnyMasks);
+		SetBits(Compiled[ListenerIndex].AllTags, AllMasks);
+		SetBits(Compiled[ListenerIndex].IgnoreTags, IgnoreMasks);
+	}
+}
+
+void FGameEventTagFilterTable::Evaluate(const FGameplayTagContainer& PayloadTags, TBitArray<>& OutPassed) const
+{
+	OutPassed.Init(true, NumListeners);
+	if (NumListeners == 0)
+	{
+		return;
+	}
+
+	// The payload only needs the bits of the tags some filter references, HasTag includes the payload's parent tags
+	TArray<uint64, TInlineAllocator<4>> PayloadWords;
+	PayloadWords.SetNumZeroed(NumWords);
+	for (int32 Bit = 0; Bit < Tags.Num(); ++Bit)
+	{
+		if (PayloadTags.HasTag(Tags[Bit]))
+		{
+			PayloadWords[Bit >> 6] |= 1ull << (Bit & 63);
+		}
+	}
+
+	const uint64* Payload = PayloadWords.GetData();
+	const uint64* AnyRow = AnyMasks.GetData();
+	const uint64* AllRow = AllMasks.GetData();
+	const uint64* IgnoreRow = IgnoreMasks.GetData();
+	for (int32 ListenerIndex = 0; ListenerIndex < NumListeners; ++ListenerIndex)
+	{
+		uint64 AnyRequired = 0;
+		uint64 AnyFound = 0;
+		uint64 AllMissing = 0;
+		uint64 IgnoredFound = 0;
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			AnyRequired |= AnyRow[Word];
+			AnyFound |= AnyRow[Word] & Payload[Word];
+			AllMissing |= AllRow[Word] & ~Payload[Word];
+			IgnoredFound |= IgnoreRow[Word] & Payload[Word];
+		}
+		OutPassed[ListenerIndex] = (AnyRequired == 0 || AnyFound != 0) && AllMissing == 0 && IgnoredFound == 0;
+
+		AnyRow += NumWords;
+		AllRow += NumWords;
+		IgnoreRow += NumWords;
+	}
+
+	for (const TPair<int32, const FGameplayTagQuery*>& Fallback : QueryFallbacks)
+	{
+		if (OutPassed[Fallback.Key] && !Fallback.Value->Matches(PayloadTags))
+		{
+			OutPassed[Fallback.Key] = false;
+		}
+	}
+}
+
+const FGameplayTagContainer& FGameEventTagFilterTable::GetPayloadTags(const TArray<FPropertyContext>& PropertyContexts, FGameplayTagContainer& Scratch)
+{
+	for (const FPropertyContext& PropertyContext : PropertyContexts)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(PropertyContext.Property.Get());
+		if (!StructProperty || !PropertyContext.PropertyPtr)
+		{
+			continue;
+		}
+
+		if (StructProperty->Struct == FGameplayTagContainer::StaticStruct())
+		{
+			return *static_cast<const FGameplayTagContainer*>(PropertyContext.PropertyPtr);
+		}
+		if (StructProperty->Struct == FGameplayTag::StaticStruct())
+		{
+			Scratch.AddTag(*static_cast<const FGameplayTag*>(PropertyContext.PropertyPtr));
+			return Scratch;
+		}
+	}
+	return Scratch;
+}
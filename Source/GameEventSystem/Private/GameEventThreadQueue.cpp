@@ -0,0 +1,306 @@
+#include "GameEventThreadQueue.h"
+#include "GameEventPayloadArena.h"
+#include "Logger.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UnrealType.h"
+
+FGameEventThreadQueue::FGameEventThreadQueue(const int32 InCapacity, const EGameEventOverflowPolicy InOverflowPolicy) : OverflowPolicy(InOverflowPolicy),
+                                                                                                                       EnqueuePosition(0),
+                                                                                                                       DequeuePosition(0),
+                                                                                                                       NumPushed(0),
+                                                                                                                       NumDelivered(0),
+                                                                                                                       NumDroppedOldest(0),
+                                                                                                                       NumDroppedNewest(0),
+                                                                                                                       NumBlocked(0)
+{
+	const uint64 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2)));
+	Mask = Capacity - 1;
+
+	Slots = new FSlot[Capacity];
+	for (uint64 Index = 0; Index < Capacity; ++Index)
+	{
+		Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+		Slots[Index].Stamp.store(MAX_uint64, std::memory_order_relaxed);
+	}
+}
+
+FGameEventThreadQueue::~FGameEventThreadQueue()
+{
+	Reset();
+	delete[] Slots;
+}
+
+bool FGameEventThreadQueue::Push(const FEventContext& EventContext, const uint64 Stamp)
+{
+	if (TryPush(EventContext, Stamp))
+	{
+		NumPushed.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	switch (OverflowPolicy)
+	{
+	case EGameEventOverflowPolicy::DropOldest:
+		{
+			do
+			{
+				// A slot that is being dispatched has already left the ring, wait for it instead of evicting another one
+				if (EnqueuePosition.load(std::memory_order_relaxed) - DequeuePosition.load(std::memory_order_relaxed) <= Mask)
+				{
+					// Sent by a listener while the game thread itself holds that slot
+					if (IsInGameThread())
+					{
+						NumDroppedNewest.fetch_add(1, std::memory_order_relaxed);
+						return false;
+					}
+					FPlatformProcess::Yield();
+					continue;
+				}
+
+				FGCScopeGuard GCGuard;
+				uint64 Position;
+				if (FSlot* Oldest = TryClaimOldest(Position))
+				{
+					DestroyPayload(*Oldest);
+					ReleaseSlot(*Oldest, Position);
+					NumDroppedOldest.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			while (!TryPush(EventContext, Stamp));
+			break;
+		}
+	case EGameEventOverflowPolicy::Block:
+		{
+			// The game thread is the consumer, blocking it would never free a slot
+			if (IsInGameThread())
+			{
+				GES_LOG_WARNING(TEXT("Event[%s] - Producer ring is full on the game thread, event dropped"), *EventContext.EventId.GetName());
+				NumDroppedNewest.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			NumBlocked.fetch_add(1, std::memory_order_relaxed);
+			while (!TryPush(EventContext, Stamp))
+			{
+				FPlatformProcess::Yield();
+			}
+			break;
+		}
+	default:
+		NumDroppedNewest.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	NumPushed.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+uint64 FGameEventThreadQueue::PeekStamp() const
+{
+	const uint64 Position = DequeuePosition.load(std::memory_order_relaxed);
+	const FSlot& Slot = Slots[Position & Mask];
+	if (Slot.Sequence.load(std::memory_order_acquire) != Position + 1)
+	{
+		return MAX_uint64;
+	}
+	return Slot.Stamp.load(std::memory_order_relaxed);
+}
+
+bool FGameEventThreadQueue::PopAndDispatch(TFunctionRef<void(const FEventContext&)> Dispatch)
+{
+	uint64 Position;
+	FSlot* Slot = TryClaimOldest(Position);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	FEventContext EventContext;
+	EventContext.EventId = FEventId(Slot->EventHandle);
+	if (Slot->WorldContext.IsStale())
+	{
+		GES_LOG_WARNING(TEXT("Event[%s] - World context destroyed while the send was in the producer ring, dropped"), *EventContext.EventId.GetName());
+	}
+	else
+	{
+		EventContext.WorldContext = Slot->WorldContext.Get();
+		EventContext.PropertyContexts = Slot->PropertyContexts;
+		Dispatch(EventContext);
+	}
+
+	DestroyPayload(*Slot);
+	ReleaseSlot(*Slot, Position);
+	NumDelivered.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+void FGameEventThreadQueue::Reset()
+{
+	uint64 Position;
+	while (FSlot* Slot = TryClaimOldest(Position))
+	{
+		DestroyPayload(*Slot);
+		ReleaseSlot(*Slot, Position);
+	}
+}
+
+void FGameEventThreadQueue::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	// No producer is inside its GC guard and the game thread consumer is held by the collector, the ring is still
+	for (uint64 Position = DequeuePosition.load(std::memory_order_acquire); Position != EnqueuePosition.load(std::memory_order_acquire); ++Position)
+	{
+		const FSlot& Slot = Slots[Position & Mask];
+		if (Slot.Sequence.load(std::memory_order_acquire) != Position + 1)
+		{
+			continue;
+		}
+		for (const FPropertyContext& Context : Slot.PropertyContexts)
+		{
+			FGameEventPayloadArena::AddPropertyReferences(Collector, Context);
+		}
+	}
+}
+
+FString FGameEventThreadQueue::GetReferencerName() const
+{
+	return TEXT("FGameEventThreadQueue");
+}
+
+FGameEventThreadQueueStats FGameEventThreadQueue::GetStats() const
+{
+	FGameEventThreadQueueStats Stats;
+	Stats.NumPushed = NumPushed.load(std::memory_order_relaxed);
+	Stats.NumDelivered = NumDelivered.load(std::memory_order_relaxed);
+	Stats.NumDroppedOldest = NumDroppedOldest.load(std::memory_order_relaxed);
+	Stats.NumDroppedNewest = NumDroppedNewest.load(std::memory_order_relaxed);
+	Stats.NumBlocked = NumBlocked.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+bool FGameEventThreadQueue::TryPush(const FEventContext& EventContext, const uint64 Stamp)
+{
+	// Claimed and published without the collector running, it never sees a half written slot
+	FGCScopeGuard GCGuard;
+
+	uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+	FSlot* Slot;
+	for (;;)
+	{
+		Slot = &Slots[Position & Mask];
+		const uint64 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+		const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+		if (Diff == 0)
+		{
+			if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (Diff < 0)
+		{
+			// The slot still holds an event from the previous lap, the ring is full
+			return false;
+		}
+		else
+		{
+			Position = EnqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	Slot->EventHandle = EventContext.EventId.FindOrAddHandle();
+	Slot->WorldContext = EventContext.WorldContext;
+	Slot->Stamp.store(Stamp, std::memory_order_relaxed);
+	WritePayload(*Slot, EventContext.PropertyContexts);
+
+	Slot->Sequence.store(Position + 1, std::memory_order_release);
+	return true;
+}
+
+FGameEventThreadQueue::FSlot* FGameEventThreadQueue::TryClaimOldest(uint64& OutPosition)
+{
+	uint64 Position = DequeuePosition.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		FSlot* Slot = &Slots[Position & Mask];
+		const uint64 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+		const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Position + 1);
+		if (Diff == 0)
+		{
+			if (DequeuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+			{
+				OutPosition = Position;
+				return Slot;
+			}
+		}
+		else if (Diff < 0)
+		{
+			// Empty, or the oldest slot is claimed but not yet published
+			return nullptr;
+		}
+		else
+		{
+			Position = DequeuePosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void FGameEventThreadQueue::ReleaseSlot(FSlot& Slot, const uint64 Position)
+{
+	Slot.Stamp.store(MAX_uint64, std::memory_order_relaxed);
+	Slot.Sequence.store(Position + Mask + 1, std::memory_order_release);
+}
+
+void FGameEventThreadQueue::WritePayload(FSlot& Slot, const TArray<FPropertyContext>& Source)
+{
+	// Lay out every value first so the buffer is sized once, it keeps its capacity across laps
+	TArray<SIZE_T, TInlineAllocator<8>> Offsets;
+	SIZE_T TotalSize = 0;
+	for (const FPropertyContext& Context : Source)
+	{
+		const FProperty* Property = Context.Property.Get();
+		if (!Property || !Context.PropertyPtr)
+		{
+			Offsets.Add(INDEX_NONE);
+			continue;
+		}
+		TotalSize = Align(TotalSize, FMath::Max<SIZE_T>(Property->GetMinAlignment(), 1));
+		Offsets.Add(TotalSize);
+		TotalSize += Property->GetSize();
+	}
+
+	if (Slot.Payload.Num() < static_cast<int32>(TotalSize))
+	{
+		Slot.Payload.SetNumUninitialized(static_cast<int32>(TotalSize));
+	}
+	Slot.PropertyContexts.Reset(Source.Num());
+
+	for (int32 Index = 0; Index < Source.Num(); ++Index)
+	{
+		if (Offsets[Index] == static_cast<SIZE_T>(INDEX_NONE))
+		{
+			Slot.PropertyContexts.Add(FPropertyContext());
+			continue;
+		}
+
+		FProperty* Property = Source[Index].Property.Get();
+		void* Dest = Slot.Payload.GetData() + Offsets[Index];
+		Property->InitializeValue(Dest);
+		Property->CopyCompleteValue(Dest, Source[Index].PropertyPtr);
+		Slot.PropertyContexts.Add(FPropertyContext(Property, Dest));
+	}
+}
+
+void FGameEventThreadQueue::DestroyPayload(FSlot& Slot)
+{
+	for (const FPropertyContext& Context : Slot.PropertyContexts)
+	{
+		if (const FProperty* Property = Context.Property.Get())
+		{
+			if (Context.PropertyPtr)
+			{
+				Property->DestroyValue(Context.PropertyPtr);
+			}
+		}
+	}
+	Slot.PropertyContexts.Reset();
+}
@@ -0,0 +1,514 @@
+#include "GameEventWildcardIndex.h"
+#include "Algo/StableSort.h"
+#include "GameEventIdRegistry.h"
+#include "Logger.h"
+
+namespace GameEventWildcard
+{
+	static const FName AnySegment(TEXT("*"));
+	static const FName AnyDepth(TEXT("**"));
+
+	static bool IsWildcard(const FName Segment)
+	{
+		return Segment == AnySegment || Segment == AnyDepth;
+	}
+}
+
+FGameEventWildcardIndex::FGameEventWildcardIndex() : PatternGeneration(0),
+                                                     NumPatterns(0)
+{
+}
+
+bool FGameEventWildcardIndex::IsPattern(const FString& EventName)
+{
+	// "*" and "**" always exist as names, so finding them is enough
+	FSegments Segments;
+	SplitSegments(EventName, FNAME_Find, Segments);
+	return Segments.ContainsByPredicate(&GameEventWildcard::IsWildcard);
+}
+
+void FGameEventWildcardIndex::SetPatternListeners(const FGameEventHandle PatternHandle, const FListenerSnapshot& Listeners)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	const int32* ExistingIndex = PatternIndices.Find(PatternHandle);
+	const int32 PatternIndex = ExistingIndex ? *ExistingIndex : AddPattern(PatternHandle);
+
+	FPattern& Pattern = Patterns[PatternIndex];
+	Pattern.Listeners = Listeners;
+
+	// Only the events this pattern matches see a different list
+	for (const FGameEventHandle EventHandle : Pattern.MatchedEvents)
+	{
+		RebuildLeaf(Leaves.FindChecked(EventHandle));
+	}
+}
+
+void FGameEventWildcardIndex::RemovePattern(const FGameEventHandle PatternHandle)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	int32 PatternIndex = INDEX_NONE;
+	if (!PatternIndices.RemoveAndCopyValue(PatternHandle, PatternIndex))
+	{
+		return;
+	}
+
+	FPattern& Pattern = Patterns[PatternIndex];
+	for (const FGameEventHandle EventHandle : Pattern.MatchedEvents)
+	{
+		FLeaf& Leaf = Leaves.FindChecked(EventHandle);
+		Leaf.Patterns.Remove(PatternIndex);
+		RebuildLeaf(Leaf);
+	}
+
+	Nodes[Pattern.Node].Pattern = INDEX_NONE;
+	Pattern = FPattern();
+	FreePatterns.Add(PatternIndex);
+	PatternGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+	GES_LOG_DISPLAY(TEXT("Event[%s] - Wildcard subscription removed"), *FGameEventIdRegistry::Get().GetName(PatternHandle).ToString());
+
+	// The cached lists of every event sent so far are dead weight once nothing matches them
+	if (NumPatterns.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Nodes.Reset();
+		Patterns.Reset();
+		FreePatterns.Reset();
+		Leaves.Reset();
+		LeafOrder.Reset();
+		LeavesWithUnknownSegments.Reset();
+		NextLeaf = 0;
+		LeavesByPrefix.Reset();
+		ForgetUnmatchedEvents();
+	}
+}
+
+FListenerSnapshot FGameEventWildcardIndex::Find(const FGameEventHandle EventHandle)
+{
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const FLeaf* Leaf = Leaves.Find(EventHandle))
+		{
+			return Leaf->Listeners;
+		}
+	}
+	{
+		FReadScopeLock ReadLock(UnmatchedLock);
+		if (UnmatchedEvents.Contains(EventHandle))
+		{
+			return nullptr;
+		}
+	}
+
+	// Not seen since the patterns last changed, the name is split with no lock held
+	FSegments Segments;
+	SplitSegments(EventHandle, FNAME_Find, Segments);
+
+	// Sending to a pattern name only reaches its own listeners
+	const bool bIsPattern = Segments.ContainsByPredicate(&GameEventWildcard::IsWildcard);
+
+	TArray<int32> MatchedPatterns;
+	uint32 Generation = 0;
+	{
+		FReadScopeLock ReadLock(Lock);
+		Generation = PatternGeneration.load(std::memory_order_acquire);
+		if (!bIsPattern && Nodes.Num() > 0)
+		{
+			CollectMatches(0, Segments, MatchedPatterns);
+		}
+	}
+
+	if (MatchedPatterns.Num() == 0)
+	{
+		FWriteScopeLock WriteLock(UnmatchedLock);
+
+		// A pattern added since the walk may match the event, only a current answer is remembered
+		if (Generation == PatternGeneration.load(std::memory_order_acquire))
+		{
+			if (UnmatchedOrder.Num() < MaxUnmatchedEvents)
+			{
+				UnmatchedOrder.Add(EventHandle);
+			}
+			else
+			{
+				UnmatchedEvents.Remove(UnmatchedOrder[NextUnmatched]);
+				UnmatchedOrder[NextUnmatched] = EventHandle;
+				NextUnmatched = (NextUnmatched + 1) % MaxUnmatchedEvents;
+			}
+			UnmatchedEvents.Add(EventHandle);
+		}
+		return nullptr;
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// Another sender may have built the leaf between the two locks
+	if (const FLeaf* Leaf = Leaves.Find(EventHandle))
+	{
+		return Leaf->Listeners;
+	}
+
+	// The pattern indices found under the read lock may have been removed or reused since
+	if (Generation != PatternGeneration.load(std::memory_order_acquire))
+	{
+		MatchedPatterns.Reset();
+		if (Nodes.Num() > 0)
+		{
+			CollectMatches(0, Segments, MatchedPatterns);
+		}
+		if (MatchedPatterns.Num() == 0)
+		{
+			return nullptr;
+		}
+	}
+
+	return AddLeaf(EventHandle, Segments, MoveTemp(MatchedPatterns)).Listeners;
+}
+
+bool FGameEventWildcardIndex::HasMatch(const FStringView EventName) const
+{
+	FSegments Segments;
+	SplitSegments(EventName, FNAME_Find, Segments);
+	if (Segments.ContainsByPredicate(&GameEventWildcard::IsWildcard))
+	{
+		return false;
+	}
+
+	TArray<int32> MatchedPatterns;
+	FReadScopeLock ReadLock(Lock);
+	if (Nodes.Num() > 0)
+	{
+		CollectMatches(0, Segments, MatchedPatterns);
+	}
+	return MatchedPatterns.Num() > 0;
+}
+
+void FGameEventWildcardIndex::Empty()
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	Nodes.Empty();
+	Patterns.Empty();
+	FreePatterns.Empty();
+	PatternIndices.Empty();
+	Leaves.Empty();
+	LeafOrder.Empty();
+	LeavesWithUnknownSegments.Empty();
+	NextLeaf = 0;
+	LeavesByPrefix.Empty();
+	ForgetUnmatchedEvents();
+	PatternGeneration.fetch_add(1, std::memory_order_acq_rel);
+	NumPatterns.store(0, std::memory_order_release);
+}
+
+void FGameEventWildcardIndex::SplitSegments(const FStringView Name, const EFindName FindType, FSegments& OutSegments)
+{
+	int32 SegmentStart = 0;
+	for (int32 Index = 0; Index <= Name.Len(); ++Index)
+	{
+		if (Index < Name.Len() && Name[Index] != TEXT('.'))
+		{
+			continue;
+		}
+
+		// Empty segments are skipped like ParseIntoArray does
+		if (Index > SegmentStart)
+		{
+			OutSegments.Add(FName(Index - SegmentStart, Name.GetData() + SegmentStart, FindType));
+		}
+		SegmentStart = Index + 1;
+	}
+}
+
+void FGameEventWildcardIndex::SplitSegments(const FGameEventHandle Handle, const EFindName FindType, FSegments& OutSegments)
+{
+	FNameBuilder NameBuilder;
+	FGameEventIdRegistry::Get().GetName(Handle).ToString(NameBuilder);
+	SplitSegments(NameBuilder.ToView(), FindType, OutSegments);
+}
+
+void FGameEventWildcardIndex::HashPrefixes(const TConstArrayView<FName> Segments, const int32 NumSegments, TArray<uint32>& OutHashes)
+{
+	uint32 Hash = 0;
+	OutHashes.Reserve(NumSegments);
+	for (int32 Index = 0; Index < NumSegments; ++Index)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Segments[Index]));
+		OutHashes.Add(Hash);
+	}
+}
+
+bool FGameEventWildcardIndex::MatchSegments(const TConstArrayView<FName> Pattern, const TConstArrayView<FName> Segments)
+{
+	if (Pattern.Num() == 0)
+	{
+		return Segments.Num() == 0;
+	}
+
+	if (Pattern[0] == GameEventWildcard::AnyDepth)
+	{
+		for (int32 Skipped = 0; Skipped <= Segments.Num(); ++Skipped)
+		{
+			if (MatchSegments(Pattern.RightChop(1), Segments.RightChop(Skipped)))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	if (Segments.Num() == 0)
+	{
+		return false;
+	}
+
+	// An unknown segment only matches a wildcard
+	const bool bSegmentMatches = Pattern[0] == GameEventWildcard::AnySegment || (!Segments[0].IsNone() && Pattern[0] == Segments[0]);
+	return bSegmentMatches && MatchSegments(Pattern.RightChop(1), Segments.RightChop(1));
+}
+
+void FGameEventWildcardIndex::CollectMatches(const int32 NodeIndex, const TConstArrayView<FName> Segments, TArray<int32>& OutPatterns) const
+{
+	const FNode& Node = Nodes[NodeIndex];
+
+	// "**" also matches no segment at all
+	if (Node.AnyDepthChild != INDEX_NONE)
+	{
+		for (int32 Skipped = 0; Skipped <= Segments.Num(); ++Skipped)
+		{
+			CollectMatches(Node.AnyDepthChild, Segments.RightChop(Skipped), OutPatterns);
+		}
+	}
+
+	if (Segments.Num() == 0)
+	{
+		if (Node.Pattern != INDEX_NONE)
+		{
+			OutPatterns.AddUnique(Node.Pattern);
+		}
+		return;
+	}
+
+	// An unknown segment has no literal child, only the wildcards below can match it
+	const int32* Child = Segments[0].IsNone() ? nullptr : Node.Children.Find(Segments[0]);
+	if (Child)
+	{
+		CollectMatches(*Child, Segments.RightChop(1), OutPatterns);
+	}
+	if (Node.AnySegmentChild != INDEX_NONE)
+	{
+		CollectMatches(Node.AnySegmentChild, Segments.RightChop(1), OutPatterns);
+	}
+}
+
+int32 FGameEventWildcardIndex::AddPattern(const FGameEventHandle PatternHandle)
+{
+	FSegments Segments;
+	SplitSegments(PatternHandle, FNAME_Add, Segments);
+
+	if (Nodes.Num() == 0)
+	{
+		Nodes.AddDefaulted();
+	}
+
+	// Nodes may reallocate while the path is extended, so only indices are kept
+	int32 NodeIndex = 0;
+	for (const FName Segment : Segments)
+	{
+		int32 ChildIndex = INDEX_NONE;
+		if (Segment == GameEventWildcard::AnyDepth)
+		{
+			ChildIndex = Nodes[NodeIndex].AnyDepthChild;
+		}
+		else if (Segment == GameEventWildcard::AnySegment)
+		{
+			ChildIndex = Nodes[NodeIndex].AnySegmentChild;
+		}
+		else
+		{
+			const int32* Child = Nodes[NodeIndex].Children.Find(Segment);
+			ChildIndex = Child ? *Child : INDEX_NONE;
+		}
+
+		if (ChildIndex == INDEX_NONE)
+		{
+			ChildIndex = Nodes.AddDefaulted();
+			if (Segment == GameEventWildcard::AnyDepth)
+			{
+				Nodes[NodeIndex].AnyDepthChild = ChildIndex;
+			}
+			else if (Segment == GameEventWildcard::AnySegment)
+			{
+				Nodes[NodeIndex].AnySegmentChild = ChildIndex;
+			}
+			else
+			{
+				Nodes[NodeIndex].Children.Add(Segment, ChildIndex);
+			}
+		}
+		NodeIndex = ChildIndex;
+	}
+
+	const int32 PatternIndex = FreePatterns.Num() > 0 ? FreePatterns.Pop() : Patterns.AddDefaulted();
+	FPattern& Pattern = Patterns[PatternIndex];
+	Pattern.Handle = PatternHandle;
+	Pattern.Segments.Append(Segments);
+	Pattern.Node = NodeIndex;
+
+	Nodes[NodeIndex].Pattern = PatternIndex;
+	PatternIndices.Add(PatternHandle, PatternIndex);
+	PatternGeneration.fetch_add(1, std::memory_order_acq_rel);
+	NumPatterns.fetch_add(1, std::memory_order_acq_rel);
+
+	// Events remembered as unmatched may match the new pattern, and so may cached events with a segment it names
+	ForgetUnmatchedEvents();
+	for (const FGameEventHandle EventHandle : LeavesWithUnknownSegments.Array())
+	{
+		EvictLeaf(EventHandle);
+	}
+
+	// Cached events join the new pattern when it matches them, only the ones sharing its literal prefix can
+	const auto JoinLeaf = [this, &Pattern, PatternIndex](const FGameEventHandle EventHandle)
+	{
+		FLeaf& Leaf = Leaves.FindChecked(EventHandle);
+		if (MatchSegments(Pattern.Segments, Leaf.Segments))
+		{
+			Leaf.Patterns.Add(PatternIndex);
+			Leaf.Patterns.Sort();
+			Pattern.MatchedEvents.Add(EventHandle);
+		}
+	};
+
+	const int32 LiteralPrefix = Pattern.Segments.IndexOfByPredicate(&GameEventWildcard::IsWildcard);
+	if (LiteralPrefix > 0)
+	{
+		TArray<uint32> PrefixHashes;
+		HashPrefixes(Pattern.Segments, LiteralPrefix, PrefixHashes);
+		if (const TSet<FGameEventHandle>* Candidates = LeavesByPrefix.Find(PrefixHashes.Last()))
+		{
+			for (const FGameEventHandle EventHandle : *Candidates)
+			{
+				JoinLeaf(EventHandle);
+			}
+		}
+	}
+	else
+	{
+		for (const TPair<FGameEventHandle, FLeaf>& Pair : Leaves)
+		{
+			JoinLeaf(Pair.Key);
+		}
+	}
+
+	GES_LOG_DISPLAY(TEXT("Event[%s] - Wildcard subscription added, matches %d known events"), *FGameEventIdRegistry::Get().GetName(PatternHandle).ToString(), Pattern.MatchedEvents.Num());
+	return PatternIndex;
+}
+
+FGameEventWildcardIndex::FLeaf& FGameEventWildcardIndex::AddLeaf(const FGameEventHandle EventHandle, const TConstArrayView<FName> Segments, TArray<int32>&& MatchedPatterns)
+{
+	// The oldest cached list makes room, its event is matched again by a trie walk on its next send
+	if (LeafOrder.Num() < MaxLeaves)
+	{
+		LeafOrder.Add(EventHandle);
+	}
+	else
+	{
+		EvictLeaf(LeafOrder[NextLeaf]);
+		LeafOrder[NextLeaf] = EventHandle;
+		NextLeaf = (NextLeaf + 1) % MaxLeaves;
+	}
+
+	TArray<uint32> PrefixHashes;
+	HashPrefixes(Segments, Segments.Num(), PrefixHashes);
+	for (const uint32 PrefixHash : PrefixHashes)
+	{
+		LeavesByPrefix.FindOrAdd(PrefixHash).Add(EventHandle);
+	}
+
+	if (Segments.ContainsByPredicate([](const FName Segment) { return Segment.IsNone(); }))
+	{
+		LeavesWithUnknownSegments.Add(EventHandle);
+	}
+
+	FLeaf& Leaf = Leaves.Add(EventHandle);
+	Leaf.Segments.Append(Segments.GetData(), Segments.Num());
+	Leaf.Patterns = MoveTemp(MatchedPatterns);
+	Leaf.Patterns.Sort();
+	for (const int32 PatternIndex : Leaf.Patterns)
+	{
+		Patterns[PatternIndex].MatchedEvents.Add(EventHandle);
+	}
+	RebuildLeaf(Leaf);
+	return Leaf;
+}
+
+void FGameEventWildcardIndex::EvictLeaf(const FGameEventHandle EventHandle)
+{
+	FLeaf Leaf;
+	if (!Leaves.RemoveAndCopyValue(EventHandle, Leaf))
+	{
+		return;
+	}
+
+	for (const int32 PatternIndex : Leaf.Patterns)
+	{
+		Patterns[PatternIndex].MatchedEvents.Remove(EventHandle);
+	}
+	LeavesWithUnknownSegments.Remove(EventHandle);
+
+	TArray<uint32> PrefixHashes;
+	HashPrefixes(Leaf.Segments, Leaf.Segments.Num(), PrefixHashes);
+	for (const uint32 PrefixHash : PrefixHashes)
+	{
+		TSet<FGameEventHandle>* PrefixLeaves = LeavesByPrefix.Find(PrefixHash);
+		if (PrefixLeaves && PrefixLeaves->Remove(EventHandle) > 0 && PrefixLeaves->Num() == 0)
+		{
+			LeavesByPrefix.Remove(PrefixHash);
+		}
+	}
+}
+
+void FGameEventWildcardIndex::ForgetUnmatchedEvents()
+{
+	FWriteScopeLock WriteLock(UnmatchedLock);
+	UnmatchedEvents.Reset();
+	UnmatchedOrder.Reset();
+	NextUnmatched = 0;
+}
+
+void FGameEventWildcardIndex::RebuildLeaf(FLeaf& Leaf) const
+{
+	int32 NumListeners = 0;
+	for (const int32 PatternIndex : Leaf.Patterns)
+	{
+		const FListenerSnapshot& PatternListeners = Patterns[PatternIndex].Listeners;
+		NumListeners += PatternListeners.IsValid() ? PatternListeners->Listeners.Num() : 0;
+	}
+
+	if (NumListeners == 0)
+	{
+		Leaf.Listeners.Reset();
+		return;
+	}
+
+	// Published as a new array of the pattern's shared records, senders still dispatching the previous one keep it alive
+	TSharedRef<FGameEventListenerSnapshot, ESPMode::ThreadSafe> Listeners = MakeShared<FGameEventListenerSnapshot, ESPMode::ThreadSafe>();
+	Listeners->Listeners.Reserve(NumListeners);
+	for (const int32 PatternIndex : Leaf.Patterns)
+	{
+		const FListenerSnapshot& PatternListeners = Patterns[PatternIndex].Listeners;
+		if (PatternListeners.IsValid())
+		{
+			Listeners->Listeners.Append(PatternListeners->Listeners);
+		}
+	}
+
+	// Each pattern list is already in priority order, merge them so the priorities hold across patterns too
+	if (Leaf.Patterns.Num() > 1)
+	{
+		Algo::StableSortBy(Listeners->Listeners, [](const FListenerRecord& Listener) { return Listener->Priority; }, TGreater<int32>());
+	}
+	Listeners->Finalize();
+	Leaf.Listeners = Listeners;
+}
@@ -0,0 +1,79 @@
+#include "GameEventWorldSubsystem.h"
+#include "GameEventManager.h"
+#include "GameEventSystemSettings.h"
+#include "Logger.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
+
+bool UGameEventWorldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UGameEventSystemSettings* Settings = UGameEventSystemSettings::Get();
+	return Settings && Settings->bPerWorldEventBuses && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UGameEventWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	EventManager = MakeShared<FGameEventManager>();
+	PostGarbageCollectDelegate = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UGameEventWorldSubsystem::OnPostGarbageCollect);
+
+	GES_LOG_DISPLAY(TEXT("GameEventWorldSubsystem:Initialize, Event bus created for world [%s]"), *GetNameSafe(GetWorld()));
+}
+
+void UGameEventWorldSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectDelegate);
+
+	// Nothing outside this world refers to its bus, dropping it releases the whole registry at once
+	EventManager.Reset();
+
+	GES_LOG_DISPLAY(TEXT("GameEventWorldSubsystem:Deinitialize, Event bus of world [%s] released"), *GetNameSafe(GetWorld()));
+
+	Super::Deinitialize();
+}
+
+void UGameEventWorldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!EventManager.IsValid())
+	{
+		return;
+	}
+
+	// The world flush points are handled by FGameEventQueueTicker, which knows the ticking world
+	const UGameEventSystemSettings* Settings = UGameEventSystemSettings::Get();
+	if (Settings && Settings->QueueFlushPoint == EGameEventQueueFlushPoint::EndOfFrame)
+	{
+		EventManager->FlushQueuedEvents();
+	}
+
+	EventManager->ProcessPendingPurge();
+}
+
+TStatId UGameEventWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGameEventWorldSubsystem, STATGROUP_Tickables);
+}
+
+TSharedPtr<FGameEventManager> UGameEventWorldSubsystem::FindEventManager(const UObject* WorldContext)
+{
+	if (!WorldContext || !GEngine)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+	const UGameEventWorldSubsystem* Subsystem = World ? World->GetSubsystem<UGameEventWorldSubsystem>() : nullptr;
+	return Subsystem ? Subsystem->EventManager : nullptr;
+}
+
+void UGameEventWorldSubsystem::OnPostGarbageCollect()
+{
+	if (EventManager.IsValid())
+	{
+		EventManager->PurgeDeadReceivers();
+	}
+}
@@ -0,0 +1,303 @@
+#include "GameEventManager.h"
+#include "Async/ParallelFor.h"
+#include "GameEventIdRegistry.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventConcurrentRegistryTest,
+                                 "GameEventSystem.Manager.ConcurrentSendAddRemove",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGameEventConcurrentRegistryTest::RunTest(const FString& Parameters)
+{
+	// A bus of its own, the global bus and its listeners are not touched
+	const TSharedRef<FGameEventManager> Manager = MakeShared<FGameEventManager>();
+	UObject* Receiver = GetTransientPackage();
+
+	constexpr int32 NumEvents = 64;
+	constexpr int32 NumTasks = 8;
+	constexpr int32 NumIterations = 2000;
+
+	TArray<FEventId> EventIds;
+	for (int32 Index = 0; Index < NumEvents; ++Index)
+	{
+		EventIds.Add(FEventId(FString::Printf(TEXT("GameEventSystem.Test.Concurrent.%d"), Index)));
+	}
+
+	// One listener per event stays registered for the whole test and counts every send
+	std::atomic<int32> NumPersistentCalls(0);
+	for (const FEventId& EventId : EventIds)
+	{
+		Manager->AddLambdaListener(EventId, Receiver, [&NumPersistentCalls](int32 Value)
+		{
+			NumPersistentCalls.fetch_add(1, std::memory_order_relaxed);
+		});
+	}
+
+	// Each task registers a listener, sends to its event and removes the listener again, spread over all the shards
+	std::atomic<int32> NumTransientCalls(0);
+	ParallelFor(NumTasks, [&](const int32 TaskIndex)
+	{
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const FEventId& EventId = EventIds[(TaskIndex * NumIterations + Iteration) % NumEvents];
+			const FGameEventListenerHandle ListenerHandle = Manager->AddLambdaListener(EventId, Receiver, [&NumTransientCalls](int32 Value)
+			{
+				NumTransientCalls.fetch_add(1, std::memory_order_relaxed);
+			});
+
+			Manager->SendEvent(EventId, Receiver, false, Iteration);
+			Manager->RemoveListener(ListenerHandle);
+		}
+	});
+
+	TestEqual(TEXT("Every send reached the persistent listener of its event"), NumPersistentCalls.load(), NumTasks * NumIterations);
+
+	// A transient listener is registered before its own send, sends of other tasks may reach it too
+	TestTrue(TEXT("Every transient listener heard its own send"), NumTransientCalls.load() >= NumTasks * NumIterations);
+
+	for (const FEventId& EventId : EventIds)
+	{
+		TestEqual(FString::Printf(TEXT("Only the persistent listener is left on %s"), *EventId.GetName()), Manager->GetEventListenerCount(EventId), 1);
+	}
+
+	Manager->Clear();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventNestedQueueFlushTest,
+                                 "GameEventSystem.Manager.NestedQueueFlush",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGameEventNestedQueueFlushTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FGameEventManager> Manager = MakeShared<FGameEventManager>();
+	UObject* Receiver = GetTransientPackage();
+
+	const FEventId FirstEventId(TEXT("GameEventSystem.Test.NestedFlush.First"));
+	const FEventId SecondEventId(TEXT("GameEventSystem.Test.NestedFlush.Second"));
+
+	// The first listener queues the second event and flushes from inside the flush delivering it
+	int32 NumNestedDelivered = INDEX_NONE;
+	Manager->AddLambdaListener(FirstEventId, Receiver, [&Manager, &NumNestedDelivered, &SecondEventId, Receiver](int32 Value)
+	{
+		Manager->QueueEvent(SecondEventId, Receiver, false, Value + 1);
+		NumNestedDelivered = Manager->FlushQueuedEvents();
+	});
+
+	TArray<int32> SecondValues;
+	Manager->AddLambdaListener(SecondEventId, Receiver, [&SecondValues](int32 Value)
+	{
+		SecondValues.Add(Value);
+	});
+
+	Manager->QueueEvent(FirstEventId, Receiver, false, 1);
+	Manager->QueueEvent(FirstEventId, Receiver, false, 10);
+
+	TestEqual(TEXT("The outer flush delivers both queued sends"), Manager->FlushQueuedEvents(), 2);
+	TestEqual(TEXT("The nested flush is deferred"), NumNestedDelivered, 0);
+	TestEqual(TEXT("Events queued during the flush wait for the next one"), SecondValues.Num(), 0);
+
+	TestEqual(TEXT("The next flush delivers them"), Manager->FlushQueuedEvents(), 2);
+	TestEqual(TEXT("In send order"), SecondValues, TArray<int32>({2, 11}));
+
+	Manager->Clear();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventUnobservedSendTest,
+                                 "GameEventSystem.Manager.UnobservedSendsDoNotIntern",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGameEventUnobservedSendTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FGameEventManager> Manager = MakeShared<FGameEventManager>();
+	UObject* Receiver = GetTransientPackage();
+
+	// A wildcard subscription elsewhere makes sends check the wildcard index too
+	int32 NumWildcardCalls = 0;
+	Manager->AddLambdaListener(FEventId(TEXT("GameEventSystem.Test.Observed.*")), Receiver, [&NumWildcardCalls](int32 Value)
+	{
+		++NumWildcardCalls;
+	});
+
+	const int32 NumNames = 256;
+	const int32 NumInterned = FGameEventIdRegistry::Get().Num();
+	for (int32 Index = 0; Index < NumNames; ++Index)
+	{
+		const FEventId EventId(FString::Printf(TEXT("GameEventSystem.Test.Unobserved.%d"), Index));
+		Manager->SendEvent(EventId, Receiver, false, Index);
+	}
+
+	TestEqual(TEXT("Sends nobody listens to leave the registry unchanged"), FGameEventIdRegistry::Get().Num(), NumInterned);
+	TestEqual(TEXT("Nothing heard them"), NumWildcardCalls, 0);
+
+	Manager->SendEvent(FEventId(TEXT("GameEventSystem.Test.Observed.Unique")), Receiver, false, 1);
+	TestEqual(TEXT("A name only a wildcard matches is still delivered"), NumWildcardCalls, 1);
+
+	Manager->Clear();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventShardContentionTest,
+                                 "GameEventSystem.Manager.ShardContention",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FGameEventShardContentionTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FGameEventManager> Manager = MakeShared<FGameEventManager>();
+	UObject* Receiver = GetTransientPackage();
+
+	// The manager picks the shard of an event from the low bits of its handle
+	constexpr uint32 NumShards = 16;
+	constexpr int32 NumTasks = 8;
+	constexpr int32 NumIterations = 20000;
+
+	// Each task has an event of its own: spread over distinct shards, or all of them behind the lock of one shard
+	TArray<FEventId> SpreadEventIds;
+	TArray<FEventId> SameShardEventIds;
+	uint32 SpreadShards = 0;
+	for (int32 Index = 0; SpreadEventIds.Num() < NumTasks || SameShardEventIds.Num() < NumTasks; ++Index)
+	{
+		const FEventId EventId(FString::Printf(TEXT("GameEventSystem.Test.ShardContention.%d"), Index));
+		const uint32 ShardIndex = EventId.FindOrAddHandle().Id & (NumShards - 1);
+		if (SpreadEventIds.Num() < NumTasks && (SpreadShards & (1u << ShardIndex)) == 0)
+		{
+			SpreadShards |= 1u << ShardIndex;
+			SpreadEventIds.Add(EventId);
+		}
+		else if (SameShardEventIds.Num() < NumTasks && (SameShardEventIds.Num() == 0 || ShardIndex == (SameShardEventIds[0].GetHandle().Id & (NumShards - 1))))
+		{
+			SameShardEventIds.Add(EventId);
+		}
+	}
+
+	const auto Run = [&Manager, Receiver](const TArray<FEventId>& EventIds)
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+		ParallelFor(NumTasks, [&Manager, Receiver, &EventIds](const int32 TaskIndex)
+		{
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				const FGameEventListenerHandle ListenerHandle = Manager->AddLambdaListener(EventIds[TaskIndex], Receiver, [](int32 Value)
+				{
+				});
+				Manager->RemoveListener(ListenerHandle);
+			}
+		});
+		return FPlatformTime::Seconds() - StartSeconds;
+	};
+
+	// Warm up the pools and the task threads before timing
+	Run(SpreadEventIds);
+
+	const double SpreadSeconds = Run(SpreadEventIds);
+	const double SameShardSeconds = Run(SameShardEventIds);
+
+	AddInfo(FString::Printf(TEXT("%d tasks x %d add/remove: %.3f ms on distinct shards, %.3f ms on one shard, ratio %.2f"),
+	                        NumTasks,
+	                        NumIterations,
+	                        SpreadSeconds * 1000.0,
+	                        SameShardSeconds * 1000.0,
+	                        SpreadSeconds > 0.0 ? SameShardSeconds / SpreadSeconds : 0.0));
+
+	for (const FEventId& EventId : SpreadEventIds)
+	{
+		TestEqual(FString::Printf(TEXT("No listener is left on %s"), *EventId.GetName()), Manager->GetEventListenerCount(EventId), 0);
+	}
+	for (const FEventId& EventId : SameShardEventIds)
+	{
+		TestEqual(FString::Printf(TEXT("No listener is left on %s"), *EventId.GetName()), Manager->GetEventListenerCount(EventId), 0);
+	}
+
+	Manager->Clear();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventForeignHandleTest,
+                                 "GameEventSystem.Manager.ForeignListenerHandle",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGameEventForeignHandleTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FGameEventManager> FirstManager = MakeShared<FGameEventManager>();
+	const TSharedRef<FGameEventManager> SecondManager = MakeShared<FGameEventManager>();
+	UObject* Receiver = GetTransientPackage();
+	const FEventId EventId(TEXT("GameEventSystem.Test.ForeignHandle"));
+
+	// Both managers hand out the first slot of the same shard at the same generation
+	const FGameEventListenerHandle FirstHandle = FirstManager->AddLambdaListener(EventId, Receiver, [](int32 Value)
+	{
+	});
+	const FGameEventListenerHandle SecondHandle = SecondManager->AddLambdaListener(EventId, Receiver, [](int32 Value)
+	{
+	});
+	TestTrue(TEXT("Handles of different managers differ"), FirstHandle != SecondHandle);
+
+	SecondManager->RemoveListener(FirstHandle);
+	TestEqual(TEXT("A foreign handle removes nothing"), SecondManager->GetEventListenerCount(EventId), 1);
+	{
+		FGameEventScopedListenerHandle ScopedHandle(SecondManager, FirstHandle);
+	}
+	TestEqual(TEXT("Neither does a scoped one"), SecondManager->GetEventListenerCount(EventId), 1);
+
+	SecondManager->RemoveListener(SecondHandle);
+	TestEqual(TEXT("The own handle still removes the listener"), SecondManager->GetEventListenerCount(EventId), 0);
+	TestEqual(TEXT("The first manager kept its listener"), FirstManager->GetEventListenerCount(EventId), 1);
+
+	FirstManager->Clear();
+	SecondManager->Clear();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventCoalescedBacklogTest,
+                                 "GameEventSystem.Manager.CoalescedBacklog",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGameEventCoalescedBacklogTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FGameEventManager> Manager = MakeShared<FGameEventManager>();
+	UObject* Receiver = GetTransientPackage();
+
+	// Queued sends of a lane are grouped by handle, the slow event is interned first so it is delivered first
+	const FEventId SlowEventId(TEXT("GameEventSystem.Test.CoalescedBacklog.Slow"));
+	SlowEventId.FindOrAddHandle();
+	const FEventId CoalescedEventId(TEXT("GameEventSystem.Test.CoalescedBacklog.Coalesced"));
+	CoalescedEventId.FindOrAddHandle();
+
+	FGameEventLaneConfig LaneConfig;
+	LaneConfig.BudgetMicroseconds = 1000;
+	Manager->SetQueueLaneConfig(EGameEventLane::Gameplay, LaneConfig);
+	Manager->SetEventCoalescing(CoalescedEventId, true);
+
+	// The slow listener uses up the lane budget, the coalesced send behind it is carried over
+	Manager->AddLambdaListener(SlowEventId, Receiver, [](int32 Value)
+	{
+		FPlatformProcess::Sleep(0.005f);
+	});
+
+	TArray<int32> CoalescedValues;
+	Manager->AddLambdaListener(CoalescedEventId, Receiver, [&CoalescedValues](int32 Value)
+	{
+		CoalescedValues.Add(Value);
+	});
+
+	Manager->QueueEvent(SlowEventId, Receiver, false, 0);
+	Manager->QueueEvent(CoalescedEventId, Receiver, false, 1);
+	TestEqual(TEXT("Only the slow send fits the budget"), Manager->FlushQueuedEvents(), 1);
+	TestEqual(TEXT("The coalesced send is backlogged"), CoalescedValues.Num(), 0);
+
+	Manager->QueueEvent(CoalescedEventId, Receiver, false, 2);
+	Manager->SetQueueLaneConfig(EGameEventLane::Gameplay, FGameEventLaneConfig());
+
+	TestEqual(TEXT("The newer send replaces the backlogged one"), Manager->FlushQueuedEvents(), 1);
+	TestEqual(TEXT("Only the latest payload is delivered"), CoalescedValues, TArray<int32>({2}));
+
+	Manager->Clear();
+	return true;
+}
+
+#endif
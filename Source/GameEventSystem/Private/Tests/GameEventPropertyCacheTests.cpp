@@ -0,0 +1,116 @@
+#include "GameEventManager.h"
+#include "GameEventPropertyHelper.h"
+#include "Async/ParallelFor.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GameEventPropertyCacheTests
+{
+	template<typename T>
+	FProperty* FindOrCreate(FGameEventPropertyCache& Cache, FGameEventPropertyCache::FSlot& Slot)
+	{
+		return Cache.FindOrCreate(Slot, [](const FFieldVariant& Owner)
+		{
+			return FGameEventPropertyHelper::CreatePropertyForType<T>(Owner, TEXT("Value"));
+		});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventPropertyCacheResetTest,
+                                 "GameEventSystem.PropertyCache.CreateResetCycles",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGameEventPropertyCacheResetTest::RunTest(const FString& Parameters)
+{
+	using namespace GameEventPropertyCacheTests;
+
+	// A cache of its own, the properties of the process-wide cache may be referenced by live payloads
+	FGameEventPropertyCache Cache;
+	FGameEventPropertyCache::FSlot IntSlot;
+	FGameEventPropertyCache::FSlot VectorSlot;
+	FGameEventPropertyCache::FSlot ArraySlot;
+	FGameEventPropertyCache::FSlot MapSlot;
+
+	constexpr int32 NumCycles = 1000;
+	constexpr int32 NumTasks = 8;
+
+	for (int32 Cycle = 0; Cycle < NumCycles; ++Cycle)
+	{
+		// Every task races for the same slots, each type must still be created once per cycle
+		FProperty* Created[NumTasks][4] = {};
+		ParallelFor(NumTasks, [&](const int32 TaskIndex)
+		{
+			Created[TaskIndex][0] = FindOrCreate<int32>(Cache, IntSlot);
+			Created[TaskIndex][1] = FindOrCreate<FVector>(Cache, VectorSlot);
+			Created[TaskIndex][2] = FindOrCreate<TArray<int32>>(Cache, ArraySlot);
+			Created[TaskIndex][3] = FindOrCreate<TMap<FString, int32>>(Cache, MapSlot);
+		});
+
+		for (int32 TaskIndex = 1; TaskIndex < NumTasks; ++TaskIndex)
+		{
+			for (int32 TypeIndex = 0; TypeIndex < 4; ++TypeIndex)
+			{
+				if (Created[TaskIndex][TypeIndex] != Created[0][TypeIndex])
+				{
+					AddError(FString::Printf(TEXT("Cycle %d: type %d was created more than once"), Cycle, TypeIndex));
+					return false;
+				}
+			}
+		}
+
+		if (Cache.Num() != 4)
+		{
+			AddError(FString::Printf(TEXT("Cycle %d: the cache owns %d properties, expected 4"), Cycle, Cache.Num()));
+			return false;
+		}
+
+		Cache.Reset();
+		if (Cache.Num() != 0 || Cache.NumLinked() != 0)
+		{
+			AddError(FString::Printf(TEXT("Cycle %d: %d properties left after reset, %d still linked"), Cycle, Cache.Num(), Cache.NumLinked()));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameEventPropertyCacheSoakTest,
+                                 "GameEventSystem.PropertyCache.SendSoak",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FGameEventPropertyCacheSoakTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FGameEventManager> Manager = MakeShared<FGameEventManager>();
+	UObject* Receiver = GetTransientPackage();
+	const FEventId EventId(TEXT("GameEventSystem.Test.PropertyCacheSoak"));
+
+	int64 Sum = 0;
+	Manager->AddLambdaListener(EventId, Receiver, [&Sum](int32 Value, const FString& Name, const TArray<int32>& Values)
+	{
+		Sum += Value + Values.Num();
+	});
+
+	const FString Name(TEXT("Soak"));
+	const TArray<int32> Values = { 1, 2, 3 };
+
+	// The first send creates the properties of its types, no later send may add any
+	Manager->SendEvent(EventId, Receiver, false, 0, Name, Values);
+	const int32 NumCached = FGameEventPropertyCache::Get().Num();
+
+	constexpr int32 NumSends = 1000000;
+	for (int32 Index = 1; Index < NumSends; ++Index)
+	{
+		Manager->SendEvent(EventId, Receiver, false, Index, Name, Values);
+	}
+
+	TestEqual(TEXT("Sends reuse the cached properties"), FGameEventPropertyCache::Get().Num(), NumCached);
+	TestEqual(TEXT("Every send was delivered"), Sum, static_cast<int64>(NumSends) * (NumSends - 1) / 2 + static_cast<int64>(NumSends) * Values.Num());
+
+	Manager->Clear();
+	return true;
+}
+
+#endif
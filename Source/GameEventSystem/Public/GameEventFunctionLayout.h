@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+struct FPropertyContext;
+
+/**
+ * Parameter layout of a listener UFunction, built once when the listener is linked.
+ * The parameter list of a linked UFunction never changes, so per-send validation only compares fingerprints.
+ */
+struct GAMEEVENTSYSTEM_API FGameEventFunctionLayout
+{
+	// Input parameters in declaration order, the ones an event payload is matched against
+	TArray<FProperty*> Params;
+
+	// Every CPF_Parm property that needs DestroyValue after the call, with its offset in the parameter buffer
+	TArray<FProperty*> DestructParams;
+	TArray<int32> DestructOffsets;
+
+	int32 ParmsSize = 0;
+
+	uint32 MinAlignment = 1;
+
+	// Type fingerprint of Params, equal to the payload fingerprint of an exactly matching event
+	uint64 SignatureFingerprint = 0;
+
+	// Signature plus buffer size and parameter offsets, functions with equal values take identical frames
+	uint64 FrameFingerprint = 0;
+
+	// Native function without out, non-const reference or return parameters, so it cannot write to a frame it is given
+	bool bCanShareFrame = false;
+
+	static TSharedPtr<const FGameEventFunctionLayout, ESPMode::ThreadSafe> Create(const UFunction* Function);
+
+	/** Type fingerprint of an event payload, compute once per send and compare against every listener */
+	static uint64 GetPayloadFingerprint(const TArray<FPropertyContext>& PropertyContexts);
+
+	/**
+	 * Whether a payload with this fingerprint can be passed to the function.
+	 * Exact signatures match without any walk, compatible ones (e.g. a subclass object) are validated once and remembered.
+	 */
+	bool Accepts(const UFunction* Function, const TArray<FPropertyContext>& PropertyContexts, const uint64 PayloadFingerprint) const;
+
+private:
+	static uint64 GetPropertyTypeFingerprint(const FProperty* Property);
+
+	// Last compatible payload fingerprint that differs from the signature
+	mutable std::atomic<uint64> AcceptedFingerprint {0};
+};
+
+using FGameEventFunctionLayoutPtr = TSharedPtr<const FGameEventFunctionLayout, ESPMode::ThreadSafe>;
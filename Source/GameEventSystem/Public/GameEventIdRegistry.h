@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Compact identifier of an interned event name.
+ * Handles are stable for the lifetime of the process, 0 is reserved as invalid.
+ */
+struct GAMEEVENTSYSTEM_API FGameEventHandle
+{
+	uint32 Id;
+
+	FGameEventHandle() : Id(0)
+	{
+	}
+
+	explicit FGameEventHandle(const uint32 InId) : Id(InId)
+	{
+	}
+
+	bool IsValid() const
+	{
+		return Id != 0;
+	}
+
+	bool operator==(const FGameEventHandle& Other) const
+	{
+		return Id == Other.Id;
+	}
+
+	bool operator!=(const FGameEventHandle& Other) const
+	{
+		return Id != Other.Id;
+	}
+
+	friend uint32 GetTypeHash(const FGameEventHandle& Handle)
+	{
+		return Handle.Id;
+	}
+};
+
+/**
+ * Process-wide interning table for event names and GameplayTags.
+ * Every distinct event name is mapped once to a FGameEventHandle, so the event maps only hash and compare integers.
+ * Name matching follows FName rules (case-insensitive), the same as the previous FString keys.
+ */
+class GAMEEVENTSYSTEM_API FGameEventIdRegistry
+{
+public:
+	static FGameEventIdRegistry& Get();
+
+	/** Intern an event name, returns the existing handle if the name is already known */
+	FGameEventHandle FindOrAdd(FStringView EventName);
+
+	/** Look up an event name without interning it, never allocates */
+	FGameEventHandle Find(FStringView EventName) const;
+
+	/** Intern a GameplayTag, the tag to event name conversion only runs the first time a tag is seen */
+	FGameEventHandle FindOrAddTag(const FGameplayTag& Tag);
+
+	/** Look up a GameplayTag without interning it */
+	FGameEventHandle FindTag(const FGameplayTag& Tag) const;
+
+	FName GetName(const FGameEventHandle Handle) const;
+
+	int32 Num() const;
+
+private:
+	FGameEventIdRegistry();
+
+	FGameEventHandle FindOrAddName(const FName EventName);
+
+	mutable FRWLock Lock;
+
+	TMap<FName, uint32> NameToId;
+
+	TMap<FGameplayTag, uint32> TagToId;
+
+	// Indexed by handle id, slot 0 is the invalid handle
+	TArray<FName> Names;
+};
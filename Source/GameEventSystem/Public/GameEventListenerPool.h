@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Single owner of the listeners of one manager shard, guarded by the shard lock.
+ * Listeners live in one contiguous slot array and every other index refers to them by FGameEventListenerHandle.
+ * A removed slot bumps its generation and joins the free list, so stale handles fail to resolve instead of reaching
+ * the listener that reuses the slot. A slot that used up its generations is retired instead, no generation ever repeats.
+ * Handles also carry the owner id of the pool, so a handle of another bus never resolves here even with a live slot.
+ */
+class GAMEEVENTSYSTEM_API FGameEventListenerPool
+{
+public:
+	/** A listener and where it is registered */
+	struct FEntry
+	{
+		// The only copy of the listener, snapshots publishing it share the record
+		TSharedPtr<const FListenerContext, ESPMode::ThreadSafe> Listener;
+
+		FGameEventHandle EventHandle;
+
+		// Key the listener was registered with, stays usable after the receiver is destroyed
+		FGameEventListenerKey Key;
+
+		// Receiver index key, stays usable after the receiver is destroyed
+		FObjectKey ReceiverKey;
+	};
+
+	/**
+	 * @param InPoolIndex Index stored in the handles of this pool, below FGameEventListenerHandle::MaxPools
+	 * @param InOwnerId Id of the bus owning the pool, shared by all the pools of one bus
+	 */
+	explicit FGameEventListenerPool(const uint32 InPoolIndex = 0, const uint32 InOwnerId = NewOwnerId());
+
+	/** Unique id for the pools of a new bus, never 0 */
+	static uint32 NewOwnerId();
+
+	/**
+	 * Store a listener as an immutable record
+	 * @return Handle of the listener, invalid if the pool is full
+	 */
+	FGameEventListenerHandle Add(const FListenerContext& Listener, const FGameEventHandle EventHandle, const FGameEventListenerKey& Key);
+
+	/** @return Whether the handle referred to a listener of this pool */
+	bool Remove(const FGameEventListenerHandle ListenerHandle);
+
+	/** @return The entry of the listener, nullptr if the handle is stale or belongs to another pool */
+	const FEntry* Find(const FGameEventListenerHandle ListenerHandle) const;
+
+	/** Number of live listeners */
+	int32 Num() const
+	{
+		return NumLive;
+	}
+
+	/** Destroy every listener, handles issued so far stay stale */
+	void Empty();
+
+private:
+	struct FSlot
+	{
+		FEntry Entry;
+
+		// Generation of the live listener, or of the next one while the slot is free. 0 once the slot is retired
+		uint32 Generation = 1;
+
+		// Next free slot while the slot is free
+		int32 NextFree = INDEX_NONE;
+
+		bool bLive = false;
+	};
+
+	// Bump the generation of a slot whose listener was destroyed and free it, unless it is retired
+	void ReleaseSlot(const int32 SlotIndex);
+
+	const FSlot* FindSlot(const FGameEventListenerHandle ListenerHandle) const;
+
+	uint32 PoolIndex;
+
+	uint32 OwnerId;
+
+	TArray<FSlot> Slots;
+
+	int32 FirstFree;
+
+	int32 NumLive;
+
+	int32 NumRetired;
+};
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+#include "GameEventPropertyHelper.h"
+#include "GameEventPinnedPayloadStore.h"
+#include "GameEventListenerPool.h"
+#include "GameEventManager.h"
+#include "Logger.h"
+
+/**
+ * Event bus scoped to one object, for events that only matter inside an actor hierarchy (weapon to owner, ability to
+ * character). Same listener and send API as FGameEventManager, but the registry is a few events in a flat array owned
+ * by the embedding object: no shards, no locks, game thread only.
+ * Sends can bubble to the bus of the owner's world (or the global bus) after the local listeners ran.
+ * Listener handles are only meaningful to the bus that issued them.
+ * Pinned payloads are copied into the parent bus's payload store, which reports their objects to the garbage collector.
+ * The bus holds its parent, so the store outlives every payload pinned here.
+ */
+class GAMEEVENTSYSTEM_API FGameEventLocalBus
+{
+public:
+	/** @param InOwner Object the bus is embedded in, resolves the bus sends bubble to */
+	explicit FGameEventLocalBus(UObject* InOwner = nullptr);
+	~FGameEventLocalBus();
+
+	FGameEventLocalBus(const FGameEventLocalBus&) = delete;
+	FGameEventLocalBus& operator=(const FGameEventLocalBus&) = delete;
+
+	void SetOwner(UObject* InOwner);
+
+	/** Forward every send to the parent bus once the local listeners ran */
+	void SetBubbling(const bool bInBubble)
+	{
+		bBubble = bInBubble;
+	}
+
+	bool IsBubbling() const
+	{
+		return bBubble;
+	}
+
+	void Clear();
+
+#pragma region  "Listener"
+	/** @return Handle of the new listener, invalid if it could not be registered or is a duplicate */
+	FGameEventListenerHandle AddListener(const FEventId& EventId, const FListenerContext& Listener);
+
+	FGameEventListenerHandle AddListenerFunction(const FEventId& EventId,
+	                                             UObject* Receiver,
+	                                             const FString& FunctionName,
+	                                             const FGameEventTagFilter& TagFilter = FGameEventTagFilter(),
+	                                             const TArray<FGameEventPayloadPredicate>& PayloadPredicates = TArray<FGameEventPayloadPredicate>(),
+	                                             const int32 Priority = 0);
+
+	template<typename Lambda>
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda);
+
+	/** Listeners of higher priority are called first, equal priorities in registration order */
+	template<typename Lambda>
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId, UObject* Receiver, const int32 Priority, Lambda&& InLambda);
+
+	void RemoveListener(const FEventId& EventId, const FListenerContext& Listener);
+	void RemoveListener(const FEventId& EventId, UObject* Receiver, const FString& FunctionName);
+
+	/** Stale handles and handles of other buses are ignored */
+	void RemoveListener(const FGameEventListenerHandle ListenerHandle);
+
+	void RemoveAllListenersForReceiver(const UObject* Receiver);
+
+	/**
+	 * Remove the listeners of every receiver destroyed by the last garbage collection, see UGameEventLocalBusComponent
+	 * @return Number of listeners removed
+	 */
+	int32 PurgeDeadReceivers();
+#pragma endregion  "Listener"
+
+#pragma region  "Send"
+	bool SendEvent(const FEventContext& EventContext);
+
+	/** Same parameters as FGameEventManager::SendEvent */
+	template<typename... Args>
+	bool SendEvent(const FEventId& EventId, UObject* WorldContext, const bool bPinned, Args&&... Params);
+#pragma endregion  "Send"
+
+	void UnpinEvent(const FEventId& EventId);
+	bool HasEvent(const FEventId& EventId) const;
+	int32 GetEventListenerCount(const FEventId& EventId) const;
+	TArray<FGameEventPriorityBucket> GetEventListenerCountsByPriority(const FEventId& EventId) const;
+
+private:
+	struct FLocalEvent
+	{
+		FGameEventHandle EventHandle;
+
+		// Descending priority, registration order within a priority, dispatch follows it
+		TArray<FGameEventListenerHandle> Listeners;
+
+		// Built on the first send after Listeners changed, dispatch keeps its own reference
+		FListenerSnapshot Snapshot;
+
+		FGameEventPinnedPayloadRef PinnedPayload;
+
+		bool bPinned = false;
+	};
+
+	/** Parent bus, resolved from the owner on first use */
+	FGameEventManager& GetParentBus();
+
+	int32 FindEvent(const FGameEventHandle EventHandle) const;
+	int32 FindOrAddEvent(const FGameEventHandle EventHandle);
+	void RemoveEventIfUnused(const int32 EventIndex);
+	FListenerSnapshot GetSnapshot(FLocalEvent& Event) const;
+
+	/** Drop the listeners of an event whose receivers were destroyed */
+	void RemoveDeadListeners(const FGameEventHandle EventHandle);
+
+	bool RemoveListenerAt(const int32 EventIndex, const int32 ListenerIndex);
+
+	TWeakObjectPtr<UObject> Owner;
+
+	// Declared before Events so the store of the pinned payloads outlives them
+	TSharedPtr<FGameEventManager> ParentBus;
+
+	// A handful of events per owner, a linear scan beats hashing at this size
+	TArray<FLocalEvent> Events;
+
+	FGameEventListenerPool Listeners;
+
+	uint64 LambdaListenerIdCounter;
+
+	bool bBubble;
+};
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventLocalBus::AddLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda)
+{
+	return AddLambdaListener(EventId, Receiver, 0, std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventLocalBus::AddLambdaListener(const FEventId& EventId, UObject* Receiver, const int32 Priority, Lambda&& InLambda)
+{
+	if (!Receiver)
+	{
+		GES_LOG_DISPLAY(TEXT("GameEventLocalBus:AddLambdaListener, Receiver cannot be null for Lambda listener"));
+		return FGameEventListenerHandle();
+	}
+
+	FListenerContext Listener;
+	FGameEventPropertyHelper::CreateListenerWrappersFromLambda(std::forward<Lambda>(InLambda),
+	                                                           Listener.LambdaFunction,
+	                                                           Listener.TypedLambdaFunction,
+	                                                           Listener.TypedPayloadId);
+	Listener.Receiver = Receiver;
+	Listener.LambdaId = LambdaListenerIdCounter++;
+	Listener.Priority = Priority;
+
+	return AddListener(EventId, Listener);
+}
+
+template<typename... Args>
+bool FGameEventLocalBus::SendEvent(const FEventId& EventId, UObject* WorldContext, const bool bPinned, Args&&... Params)
+{
+	if (!WorldContext || !EventId.IsValid())
+	{
+		return false;
+	}
+
+	FEventContext EventContext;
+	EventContext.WorldContext = WorldContext;
+	EventContext.EventId = EventId;
+	EventContext.bPinned = bPinned;
+
+	if constexpr (sizeof...(Args) == 0)
+	{
+		return SendEvent(EventContext);
+	}
+	else
+	{
+		FGameEventManager::MakePropertyContexts(WorldContext, EventContext.PropertyContexts, std::forward<Args>(Params)...);
+
+		// Pinned payloads are deep-copied by SendEvent, the typed fast path only serves the send itself
+		using FTypedPayload = TGameEventTypedPayload<std::decay_t<Args>...>;
+		const typename FTypedPayload::FTuple TypedPayload(Params...);
+		EventContext.TypedPayload = &TypedPayload;
+		EventContext.TypedPayloadId = FTypedPayload::Id;
+
+		return SendEvent(EventContext);
+	}
+}
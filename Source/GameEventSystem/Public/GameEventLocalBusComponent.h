@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameEventLocalBus.h"
+#include "GameEventLocalBusComponent.generated.h"
+
+/**
+ * Gives an actor its own FGameEventLocalBus. Actors owned by it (weapons, ability actors) find the bus through
+ * FindLocalBus, so their events stay inside the hierarchy instead of going through the world bus.
+ */
+UCLASS(ClassGroup = (GameEventSystem), meta = (BlueprintSpawnableComponent))
+class GAMEEVENTSYSTEM_API UGameEventLocalBusComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGameEventLocalBusComponent();
+
+	//~ Begin UActorComponent Interface
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End UActorComponent Interface
+
+	FGameEventLocalBus& GetBus()
+	{
+		return Bus;
+	}
+
+	/** @return Bus of the first actor in Actor's owner chain that has this component, Actor included. nullptr if none */
+	static FGameEventLocalBus* FindLocalBus(const AActor* Actor);
+
+	/** Forward every local send to the world bus once the local listeners ran */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GameEventSystem")
+	bool bBubbleToWorldBus;
+
+private:
+	void OnPostGarbageCollect();
+
+	FGameEventLocalBus Bus;
+
+	FDelegateHandle PostGarbageCollectDelegate;
+};
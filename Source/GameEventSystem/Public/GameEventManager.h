@@ -4,22 +4,65 @@
 #include "UObject/UnrealType.h"
 #include "GameEventTypes.h"
 #include "GameEventPropertyHelper.h"
+#include "GameEventQueue.h"
+#include "GameEventThreadQueue.h"
+#include "GameEventPinnedPayloadStore.h"
+#include "GameEventTable.h"
+#include "GameEventListenerPool.h"
+#include "GameEventWildcardIndex.h"
 #include "Logger.h"
+#include "Tasks/Task.h"
 #include <atomic>
 
 class UGameEventBlueprintLibrary;
 class UAsyncGameEventListener;
 class UGameEventListenerComponent;
 class FGameEventTypeManager;
+class FGameEventDispatchScope;
+class FGameEventScopedListenerHandle;
+class FGameEventLocalBus;
+
+/**
+ * Wait-free per-event listener counts indexed by FGameEventHandle.
+ * Chunks are allocated on demand and only freed with the table, so readers never take a lock.
+ * A count of INDEX_NONE means the event does not exist.
+ * Handles past the capacity of the table are not tracked, TryGet fails for them and callers ask the event shard instead.
+ */
+class GAMEEVENTSYSTEM_API FGameEventListenerCounts
+{
+public:
+	FGameEventListenerCounts();
+	~FGameEventListenerCounts();
+
+	/** @return false if Handle is past the capacity of the table, OutCount is then unknown */
+	bool TryGet(const FGameEventHandle Handle, int32& OutCount) const;
+	void Set(const FGameEventHandle Handle, const int32 Count);
+	void Reset();
+
+private:
+	static constexpr uint32 ChunkSize = 1024;
+	static constexpr uint32 MaxChunks = 4096;
+
+	std::atomic<int32>* FindOrAddChunk(const uint32 ChunkIndex);
+
+	std::atomic<std::atomic<int32>*> Chunks[MaxChunks];
+};
 
-class GAMEEVENTSYSTEM_API FGameEventManager
+class GAMEEVENTSYSTEM_API FGameEventManager : public TSharedFromThis<FGameEventManager>
 {
+	// Local buses dispatch through their parent bus and keep their pinned payloads in its store
+	friend class FGameEventLocalBus;
+
 public:
 	FGameEventManager();
 	~FGameEventManager();
 
+	/** Global bus, shared by every world. Created on first use, thread-safe */
 	static TSharedPtr<FGameEventManager> Get();
 
+	/** Bus of the world WorldContext belongs to, the global bus if per-world buses are disabled or the world has none */
+	static TSharedPtr<FGameEventManager> Get(const UObject* WorldContext);
+
 	void Clear();
 
 #pragma region "static"
@@ -30,9 +73,25 @@ public:
 #pragma endregion "static"
 
 #pragma region  "Listener"
-	void AddListener(const FEventId& EventId, const FListenerContext& Listener);
+	/**
+	 * An EventId with wildcard segments subscribes to every matching event, see FGameEventWildcardIndex:
+	 * "Combat.Damage.*" hears the direct children of Combat.Damage, "Combat.Damage.**" hears Combat.Damage and all of its
+	 * descendants. Wildcard listeners run after the listeners of the exact event, pinned events are not replayed to them.
+	 * @return Handle of the new listener, invalid if it could not be registered or is a duplicate
+	 */
+	FGameEventListenerHandle AddListener(const FEventId& EventId, const FListenerContext& Listener);
 
-	void AddListenerFunction(const FEventId& EventId, UObject* Receiver, const FString& FunctionName);
+	/**
+	 * @param TagFilter Payload tags the listener is called for, see FGameEventTagFilter
+	 * @param PayloadPredicates Payload field conditions that must all hold for the listener to be called
+	 * @param Priority Listeners of higher priority are called first, see FListenerContext::Priority
+	 */
+	FGameEventListenerHandle AddListenerFunction(const FEventId& EventId,
+	                                             UObject* Receiver,
+	                                             const FString& FunctionName,
+	                                             const FGameEventTagFilter& TagFilter = FGameEventTagFilter(),
+	                                             const TArray<FGameEventPayloadPredicate>& PayloadPredicates = TArray<FGameEventPayloadPredicate>(),
+	                                             const int32 Priority = 0);
 
 	void RemoveListener(const FEventId& EventId, const FListenerContext& Listener);
 
@@ -52,11 +111,10 @@ public:
 	void RemoveAllListenersForReceiver(const FEventId& EventId, const UObject* Receiver);
 
 	/**
-	 * Remove the Lambda listener
-	 * @param EventId Event identifier
-	 * @param LambdaListenerId AddLambdaListener returns the listener ID
+	 * Remove a listener by the handle its registration returned, stale handles are ignored
+	 * @param ListenerHandle Handle returned by AddListener, AddListenerFunction or AddLambdaListener
 	 */
-	void RemoveLambdaListener(const FEventId& EventId, const FString& LambdaListenerId);
+	void RemoveListener(const FGameEventListenerHandle ListenerHandle);
 
 	/**
 	 * 🚀 Universal Lambda listeners
@@ -66,15 +124,92 @@ public:
 	 * @param EventId Event identifier
 	 * @param Receiver Receiving Objects (for Lifecycle Management)
 	 * @param InLambda Lambda function, arbitrary signature
-	 * @return Listener ID for subsequent removal
+	 * @return Listener handle for subsequent removal
 	 */
 	template<typename Lambda>
-	FString AddLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda);
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda);
+
+	/** Same as AddLambdaListener, the lambda is only called for payloads TagFilter accepts */
+	template<typename Lambda>
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId, UObject* Receiver, const FGameEventTagFilter& TagFilter, Lambda&& InLambda);
+
+	/** Same as AddLambdaListener, the lambda is only called for payloads every predicate holds for */
+	template<typename Lambda>
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId, UObject* Receiver, const TArray<FGameEventPayloadPredicate>& PayloadPredicates, Lambda&& InLambda);
+
+	template<typename Lambda>
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId,
+	                                           UObject* Receiver,
+	                                           const FGameEventTagFilter& TagFilter,
+	                                           const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+	                                           Lambda&& InLambda);
+
+	/** Same as AddLambdaListener, listeners of higher priority are called first */
+	template<typename Lambda>
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId, UObject* Receiver, const int32 Priority, Lambda&& InLambda);
+
+	template<typename Lambda>
+	FGameEventListenerHandle AddLambdaListener(const FEventId& EventId,
+	                                           UObject* Receiver,
+	                                           const int32 Priority,
+	                                           const FGameEventTagFilter& TagFilter,
+	                                           const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+	                                           Lambda&& InLambda);
+
+	/**
+	 * Same as AddLambdaListener, but sends launch the lambda as a UE::Tasks task instead of calling it inline.
+	 * The lambda gets an immutable copy of the payload shared by the async listeners of the send, the objects it
+	 * references are kept alive until the last task is done. The receiver only scopes the registration and must not
+	 * be touched by the lambda.
+	 * @param PipeName Named pipe the task runs on, tasks of one pipe never overlap. NAME_None to run on any worker
+	 */
+	template<typename Lambda>
+	FGameEventListenerHandle AddAsyncLambdaListener(const FEventId& EventId, UObject* Receiver, const FName PipeName, Lambda&& InLambda);
+
+	/** Same as AddAsyncLambdaListener, the task is only launched for payloads TagFilter accepts */
+	template<typename Lambda>
+	FGameEventListenerHandle AddAsyncLambdaListener(const FEventId& EventId, UObject* Receiver, const FName PipeName, const FGameEventTagFilter& TagFilter, Lambda&& InLambda);
+
+	/** Same as AddAsyncLambdaListener, the task is only launched for payloads every predicate holds for */
+	template<typename Lambda>
+	FGameEventListenerHandle AddAsyncLambdaListener(const FEventId& EventId,
+	                                                UObject* Receiver,
+	                                                const FName PipeName,
+	                                                const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+	                                                Lambda&& InLambda);
+
+	template<typename Lambda>
+	FGameEventListenerHandle AddAsyncLambdaListener(const FEventId& EventId,
+	                                                UObject* Receiver,
+	                                                const FName PipeName,
+	                                                const FGameEventTagFilter& TagFilter,
+	                                                const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+	                                                Lambda&& InLambda);
+
+	/** Same as AddAsyncLambdaListener, tasks of higher priority listeners are launched first */
+	template<typename Lambda>
+	FGameEventListenerHandle AddAsyncLambdaListener(const FEventId& EventId, UObject* Receiver, const FName PipeName, const int32 Priority, Lambda&& InLambda);
+
+	template<typename Lambda>
+	FGameEventListenerHandle AddAsyncLambdaListener(const FEventId& EventId,
+	                                                UObject* Receiver,
+	                                                const FName PipeName,
+	                                                const int32 Priority,
+	                                                const FGameEventTagFilter& TagFilter,
+	                                                const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+	                                                Lambda&& InLambda);
+
+	/** Same as AddLambdaListener, the listener is removed when the returned handle is destroyed or reset */
+	template<typename Lambda>
+	FGameEventScopedListenerHandle AddScopedLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda);
 #pragma endregion  "Listener"
 
 #pragma region  "Send"
 	bool SendEvent(const FEventContext& EventContext);
 
+	/** @param OutAsyncListeners Completes once the async listeners launched by this send have run */
+	bool SendEvent(const FEventContext& EventContext, UE::Tasks::FTask& OutAsyncListeners);
+
 	/**
 	 * 🚀 Generic variable parameter SendEvent function
 	 * Automatically derive parameter types, support any number of parameters (0-N)
@@ -88,13 +223,115 @@ public:
 	 */
 	template<typename... Args>
 	bool SendEvent(const FEventId& EventId, UObject* WorldContext, const bool bPinned, Args&&... Params);
+#pragma endregion  "Send"
+
+#pragma region  "Queue"
+	/**
+	 * Defer an event to the next queue flush, the payload is deep-copied so the caller's values may go out of scope
+	 * @return Whether the event was queued
+	 */
+	bool QueueEvent(const FEventContext& EventContext);
+
+	/**
+	 * Generic variable parameter QueueEvent function, same parameters as SendEvent
+	 * @param bPinned Whether the event is pinned once it is delivered
+	 */
+	template<typename... Args>
+	bool QueueEvent(const FEventId& EventId, UObject* WorldContext, const bool bPinned, Args&&... Params);
+
+	/**
+	 * Deliver the queued events the lane budgets allow, called by the module at the configured flush point.
+	 * Events from QueueEventFromAnyThread are all delivered, they are not budgeted.
+	 * @return Number of events delivered
+	 */
+	int32 FlushQueuedEvents();
+
+	/** Queued events not delivered yet, the ones carried over by a lane budget included */
+	int32 GetQueuedEventCount() const;
+
+	/**
+	 * Put the later queued sends of an event in a flush lane, see FGameEventLaneConfig.
+	 * Events are in the Gameplay lane unless set otherwise, direct sends are not affected
+	 */
+	void SetEventLane(const FEventId& EventId, const EGameEventLane Lane);
+	EGameEventLane GetEventLane(const FEventId& EventId) const;
+
+	/** Override the budget and max latency a lane was given by the project settings */
+	void SetQueueLaneConfig(const EGameEventLane Lane, const FGameEventLaneConfig& Config);
+
+	/** Backlog and latency of a lane, updated by every flush */
+	FGameEventLaneStats GetQueueLaneStats(const EGameEventLane Lane) const;
+
+	/**
+	 * Opt an event in or out of latest-wins coalescing for QueueEvent.
+	 * Queued sends of a coalescing event between two flushes collapse into the last payload and are delivered once.
+	 */
+	void SetEventCoalescing(const FEventId& EventId, const bool bCoalesce);
+	bool IsEventCoalescing(const FEventId& EventId) const;
+
+	/**
+	 * Hand an event to the game thread from any thread without taking a manager lock.
+	 * The payload is copied into the producer's ring and delivered at the next queue flush, in send order.
+	 * Pinning is not supported on this path.
+	 * @param Producer Ring to push into, each has its own capacity and overflow policy
+	 * @return false if the ring was full and the event was dropped
+	 */
+	bool QueueEventFromAnyThread(const EGameEventProducer Producer, const FEventContext& EventContext);
+
+	template<typename... Args>
+	bool QueueEventFromAnyThread(const EGameEventProducer Producer, const FEventId& EventId, UObject* WorldContext, Args&&... Params);
+
+	/**
+	 * Deliver the events pushed from other threads so far, merged across producers by send order. Game thread only
+	 * @return Number of events delivered
+	 */
+	int32 DrainThreadedEvents();
+
+	FGameEventThreadQueueStats GetThreadQueueStats(const EGameEventProducer Producer) const;
+#pragma endregion  "Queue"
 
+#pragma region  "Send"
 private:
-	bool SendEventInternal(const FEventId& EventId, UObject* WorldContext, const bool bPinned, const TArray<FPropertyContext>& PropertyContexts);
+	template<typename... Args>
+	static void MakePropertyContexts(UObject* WorldContext, TArray<FPropertyContext>& OutPropertyContexts, Args&&... Params);
+
+	template<typename... Args>
+	FGameEventPinnedPayloadRef MakePinnedPayload(UObject* WorldContext, Args&&... Params);
+
+	/** Async listeners of one send */
+	struct FAsyncDispatch
+	{
+		// Immutable payload shared by the tasks, the pinned payload or a copy made for the first async listener
+		FGameEventPinnedPayloadRef Payload;
+
+		TArray<UE::Tasks::FTask> Tasks;
+	};
+
+	/**
+	 * Dispatch an event and, if it is pinned, keep its payload for late listeners
+	 * @param PinnedPayload Payload already owned by the manager, a pinned event without one is deep-copied
+	 * @param AsyncDispatch Collects the tasks of the async listeners, nullptr if the sender does not wait on them
+	 */
+	bool SendEventInternal(const FEventContext& EventContext, FGameEventPinnedPayloadRef PinnedPayload, FAsyncDispatch* AsyncDispatch = nullptr);
+
+	/**
+	 * Call each listener in order with no lock held, stops after a listener consumed a SpecificTarget event.
+	 * Async listeners are launched in their turn and run concurrently with the rest.
+	 * @param TagFilters Compiled filters of Listeners, without them each filtered listener is tested on its own
+	 * @return Number of listeners skipped because their receiver is gone
+	 */
+	int32 DispatchToListeners(const TConstArrayView<FListenerRecord> Listeners,
+	                          const FEventContext& EventContext,
+	                          const FGameEventTagFilterTable* TagFilters = nullptr,
+	                          FAsyncDispatch* AsyncDispatch = nullptr);
+	int32 DispatchToListeners(const FGameEventListenerSnapshot& Snapshot, const FEventContext& EventContext, FAsyncDispatch* AsyncDispatch = nullptr);
+
+	void LaunchAsyncListener(const FListenerContext& Listener, const FEventContext& EventContext, FAsyncDispatch& AsyncDispatch);
+
 	void SendEventInternal(const FListenerContext* Listener);
-	bool SendSpecificEventInternal(const FListenerContext* Listener, const FEventContext& EventContext);
-	void SendPropertyEvent(const FListenerContext* Listener, const FEventContext& EventContext);
-	void SendFunctionEvent(const FListenerContext* Listener, const TArray<FPropertyContext>& PropertyContexts);
+	bool SendSpecificEventInternal(const FListenerContext* Listener, const FEventContext& EventContext, FGameEventDispatchScope& DispatchScope);
+	void SendPropertyEvent(const FListenerContext* Listener, const FEventContext& EventContext, FGameEventDispatchScope& DispatchScope);
+	void SendFunctionEvent(const FListenerContext* Listener, const TArray<FPropertyContext>& PropertyContexts, FGameEventDispatchScope& DispatchScope);
 
 	void ProcessFunctionParameters(const TArray<FProperty*>& Params, const TArray<FPropertyContext>& PropertyContexts, uint8* ParamsBuffer, const FString& FunctionName);
 	void CopyPropertyByType(const FProperty* DestProperty, const FPropertyContext& PropertyContext, uint8* ParamsBuffer);
@@ -107,8 +344,9 @@ private:
 	void CopyStructProperty(FProperty* DestProperty, const FStructProperty* StructProp, const void* SrcPtr, uint8* ParamsBuffer);
 	void CopyObjectProperty(FProperty* DestProperty, const FObjectProperty* ObjProp, const void* SrcPtr, uint8* ParamsBuffer);
 	void CopyEnumProperty(FProperty* DestProperty, const FByteProperty* ByteProp, const void* SrcPtr, uint8* ParamsBuffer);
-	int32 RemoveListenersForReceiverInternal(const UObject* Receiver, const TSet<FEventId>* EventsToProcess = nullptr);
-	void RemoveListenerFromEvent(const FEventId& EventId, const FListenerContext& Listener);
+	int32 RemoveListenersForReceiverInternal(const UObject* Receiver, const TSet<FGameEventHandle>* EventsToProcess = nullptr);
+	void AddReceiverEntry(const FObjectKey ReceiverKey, const FGameEventHandle EventHandle, const FGameEventListenerHandle ListenerHandle);
+	void RemoveReceiverEntry(const FObjectKey ReceiverKey, const FGameEventHandle EventHandle, const FGameEventListenerHandle ListenerHandle);
 
 #pragma endregion  "Send"
 
@@ -117,57 +355,306 @@ private:
 public:
 	bool HasEvent(const FEventId& EventId);
 	int32 GetEventListenerCount(const FEventId& EventId);
+
+	/** @return Listener counts of the event per priority in dispatch order, empty if the event has no listeners */
+	TArray<FGameEventPriorityBucket> GetEventListenerCountsByPriority(const FEventId& EventId);
+
+	/** Sends delivered to nobody since startup, unobserved events included. Non-zero values point at wasted traffic */
+	uint64 GetNumSendsWithNoListeners() const
+	{
+		return NumSendsWithNoListeners.load(std::memory_order_relaxed);
+	}
 	void UnpinEvent(const FEventId& EventId);
 	void RemoveAllListenersForReceiver(const UObject* Receiver);
 
+	/**
+	 * Move the listeners of every receiver destroyed by the last garbage collection to the purge list, then purge a
+	 * first batch. Called after each garbage collection
+	 * @return Number of dead receivers found
+	 */
+	int32 PurgeDeadReceivers();
+
+	/**
+	 * Remove up to UGameEventSystemSettings::MaxPurgedListenersPerFrame listeners of the purge list, each event is
+	 * compacted and republished once per batch. Called every frame until the list is empty
+	 * @return Number of listeners removed
+	 */
+	int32 ProcessPendingPurge();
+
+	int32 GetPendingPurgeCount() const;
+
 private:
-	void CreateEvent(const FEventId& EventId, const bool bPinned = false);
+	/** One lock domain of the event registry, events are spread over the shards by handle hash */
+	struct FEventShard
+	{
+		FCriticalSection CriticalSection;
+
+		FGameEventTable Events;
+
+		// Owner of the listeners of this shard's events, the handles of its listeners carry the shard index
+		FGameEventListenerPool Listeners;
+
+		// Owned parameters of the pinned events of this shard
+		TMap<FGameEventHandle, FGameEventPinnedPayloadRef> PinnedPayloads;
+	};
+
+	static constexpr int32 NumShards = 16;
+
+	FEventShard& GetShard(const FGameEventHandle EventHandle);
+
+	// Listener count of an event, INDEX_NONE if it does not exist. Wait-free unless the handle is past ListenerCounts
+	int32 FindListenerCount(const FGameEventHandle EventHandle);
+
+	// The following must be called with the shard's CriticalSection held
+	// @return Index of the event in Shard.Events
+	int32 CreateEvent(FEventShard& Shard, const FEventId& EventId, const bool bPinned = false);
+	// Publish a new listener snapshot after Listeners changed
+	void PublishEvent(FEventShard& Shard, const int32 EventIndex);
+	void RemoveEvent(FEventShard& Shard, const int32 EventIndex);
+	// Free a listener taken out of Shard.Events and drop its receiver entry
+	void ReleaseListener(FEventShard& Shard, const FGameEventListenerHandle ListenerHandle);
+
 	void DeleteEvent(const FEventId& EventId);
 #pragma endregion
 
-	static TSharedPtr<FGameEventManager> PrivateDefaultManager;
+	// Declared before the shards so it outlives the payloads they reference
+	FGameEventPinnedPayloadStore PinnedPayloadStore;
 
-	FCriticalSection CriticalSection;
+	// Lock order: a shard lock may be held while taking ReceiverCriticalSection, never the other way around
+	FEventShard Shards[NumShards];
 
-	TMap<FEventId, FEventContext> EventMap;
+	// Mirrors the listener count of every event for lock-free HasEvent / GetEventListenerCount
+	FGameEventListenerCounts ListenerCounts;
 
-	TMap<TObjectPtr<UObject>, TArray<FListener>> ReceiverMap;
+	// Listeners of the wildcard events, flattened per concrete event. Lock order: taken under a shard lock, never the other way around
+	FGameEventWildcardIndex WildcardIndex;
 
-	// Lambda Listener Mapping Table - Used to quickly remove Lambda listeners by ID
-	TMap<FString, FListenerContext> LambdaListenerMap;
+	// Guards ReceiverMap and PendingPurge
+	mutable FCriticalSection ReceiverCriticalSection;
 
-	// Atomic counter to generate a unique event listener ID
+	// Listener handles of each receiver, keyed by FObjectKey so a reused address never aliases a dead receiver
+	TMap<FObjectKey, TSet<FListener>> ReceiverMap;
+
+	// Listeners of dead receivers not purged yet
+	TArray<FListener> PendingPurge;
+
+	// Atomic counter to generate the unique id of each lambda listener
 	std::atomic<uint64> LambdaListenerIdCounter;
+
+	FGameEventQueue EventQueue;
+
+	TUniquePtr<FGameEventThreadQueue> ThreadQueues[static_cast<int32>(EGameEventProducer::Count)];
+
+	// Global send order of QueueEventFromAnyThread, merges the producer rings on drain
+	std::atomic<uint64> ThreadedSendStamp;
+
+	std::atomic<uint64> NumSendsWithNoListeners;
+};
+
+/**
+ * Owns a listener registration and removes it when destroyed or reset.
+ * Holds the manager weakly, so it may outlive the manager.
+ */
+class GAMEEVENTSYSTEM_API FGameEventScopedListenerHandle
+{
+public:
+	FGameEventScopedListenerHandle()
+	{
+	}
+
+	FGameEventScopedListenerHandle(const TSharedRef<FGameEventManager>& InManager, const FGameEventListenerHandle InListenerHandle) : Manager(InManager),
+	                                                                                                                                 ListenerHandle(InListenerHandle)
+	{
+	}
+
+	FGameEventScopedListenerHandle(FGameEventScopedListenerHandle&& Other) : Manager(MoveTemp(Other.Manager)),
+	                                                                         ListenerHandle(Other.Release())
+	{
+	}
+
+	FGameEventScopedListenerHandle& operator=(FGameEventScopedListenerHandle&& Other);
+
+	FGameEventScopedListenerHandle(const FGameEventScopedListenerHandle&) = delete;
+	FGameEventScopedListenerHandle& operator=(const FGameEventScopedListenerHandle&) = delete;
+
+	~FGameEventScopedListenerHandle()
+	{
+		Reset();
+	}
+
+	/** Remove the listener now */
+	void Reset();
+
+	/** Give up ownership, the listener stays registered */
+	FGameEventListenerHandle Release()
+	{
+		const FGameEventListenerHandle Released = ListenerHandle;
+		ListenerHandle.Invalidate();
+		return Released;
+	}
+
+	FGameEventListenerHandle Get() const
+	{
+		return ListenerHandle;
+	}
+
+	bool IsValid() const
+	{
+		return ListenerHandle.IsValid();
+	}
+
+private:
+	TWeakPtr<FGameEventManager> Manager;
+
+	FGameEventListenerHandle ListenerHandle;
 };
 
 template<typename Lambda>
-FString FGameEventManager::AddLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda)
+FGameEventListenerHandle FGameEventManager::AddLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda)
+{
+	return AddLambdaListener(EventId, Receiver, FGameEventTagFilter(), std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddLambdaListener(const FEventId& EventId, UObject* Receiver, const FGameEventTagFilter& TagFilter, Lambda&& InLambda)
+{
+	return AddLambdaListener(EventId, Receiver, TagFilter, TArray<FGameEventPayloadPredicate>(), std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddLambdaListener(const FEventId& EventId, UObject* Receiver, const TArray<FGameEventPayloadPredicate>& PayloadPredicates, Lambda&& InLambda)
+{
+	return AddLambdaListener(EventId, Receiver, FGameEventTagFilter(), PayloadPredicates, std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddLambdaListener(const FEventId& EventId,
+                                                              UObject* Receiver,
+                                                              const FGameEventTagFilter& TagFilter,
+                                                              const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+                                                              Lambda&& InLambda)
+{
+	return AddLambdaListener(EventId, Receiver, 0, TagFilter, PayloadPredicates, std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddLambdaListener(const FEventId& EventId, UObject* Receiver, const int32 Priority, Lambda&& InLambda)
+{
+	return AddLambdaListener(EventId, Receiver, Priority, FGameEventTagFilter(), TArray<FGameEventPayloadPredicate>(), std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddLambdaListener(const FEventId& EventId,
+                                                              UObject* Receiver,
+                                                              const int32 Priority,
+                                                              const FGameEventTagFilter& TagFilter,
+                                                              const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+                                                              Lambda&& InLambda)
 {
 	if (!Receiver)
 	{
 		GES_LOG_DISPLAY(TEXT("GameEventManager:AddLambdaListener, Receiver cannot be null for Lambda listener"));
-		return FString();
+		return FGameEventListenerHandle();
 	}
 
 	// 🚀 Use Lambda type derivation to automatically expand parameter types
-	auto WrapperLambda = FGameEventPropertyHelper::CreatePropertyWrapperFromLambda(std::forward<Lambda>(InLambda));
+	// The property wrapper serves Blueprint and FEventContext senders, the typed wrapper serves native SendEvent
+	FListenerContext Listener;
+	FGameEventPropertyHelper::CreateListenerWrappersFromLambda(std::forward<Lambda>(InLambda),
+	                                                           Listener.LambdaFunction,
+	                                                           Listener.TypedLambdaFunction,
+	                                                           Listener.TypedPayloadId);
 
 	// 🔧 Use atomic counters to generate truly unique Lambda IDs
 	// Note: Each Lambda gets a unique ID, which avoids the problem of address collisions
 	// If you need to detect Lambda with the same logic, we recommend using a normal function listener
-	uint64 UniqueId = LambdaListenerIdCounter.fetch_add(1);
-	FString FunctionName = FString::Printf(TEXT("%s.lambda.%llu"), *EventId.ToString(), UniqueId);
+	Listener.Receiver = Receiver;
+	Listener.LambdaId = LambdaListenerIdCounter.fetch_add(1);
+	Listener.SetTagFilter(TagFilter);
+	Listener.SetPayloadPredicates(PayloadPredicates);
+	Listener.Priority = Priority;
+
+	return AddListener(EventId, Listener);
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddAsyncLambdaListener(const FEventId& EventId, UObject* Receiver, const FName PipeName, Lambda&& InLambda)
+{
+	return AddAsyncLambdaListener(EventId, Receiver, PipeName, FGameEventTagFilter(), std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddAsyncLambdaListener(const FEventId& EventId, UObject* Receiver, const FName PipeName, const FGameEventTagFilter& TagFilter, Lambda&& InLambda)
+{
+	return AddAsyncLambdaListener(EventId, Receiver, PipeName, TagFilter, TArray<FGameEventPayloadPredicate>(), std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddAsyncLambdaListener(const FEventId& EventId,
+                                                                   UObject* Receiver,
+                                                                   const FName PipeName,
+                                                                   const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+                                                                   Lambda&& InLambda)
+{
+	return AddAsyncLambdaListener(EventId, Receiver, PipeName, FGameEventTagFilter(), PayloadPredicates, std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddAsyncLambdaListener(const FEventId& EventId,
+                                                                   UObject* Receiver,
+                                                                   const FName PipeName,
+                                                                   const FGameEventTagFilter& TagFilter,
+                                                                   const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+                                                                   Lambda&& InLambda)
+{
+	return AddAsyncLambdaListener(EventId, Receiver, PipeName, 0, TagFilter, PayloadPredicates, std::forward<Lambda>(InLambda));
+}
+
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddAsyncLambdaListener(const FEventId& EventId, UObject* Receiver, const FName PipeName, const int32 Priority, Lambda&& InLambda)
+{
+	return AddAsyncLambdaListener(EventId, Receiver, PipeName, Priority, FGameEventTagFilter(), TArray<FGameEventPayloadPredicate>(), std::forward<Lambda>(InLambda));
+}
 
-	// calculateTheNumberOfParametersAtCompileTime
-	// constexpr size_t ParamCount = TLambdaArgsCount<std::decay_t<Lambda>>;
+template<typename Lambda>
+FGameEventListenerHandle FGameEventManager::AddAsyncLambdaListener(const FEventId& EventId,
+                                                                   UObject* Receiver,
+                                                                   const FName PipeName,
+                                                                   const int32 Priority,
+                                                                   const FGameEventTagFilter& TagFilter,
+                                                                   const TArray<FGameEventPayloadPredicate>& PayloadPredicates,
+                                                                   Lambda&& InLambda)
+{
+	if (!Receiver)
+	{
+		GES_LOG_DISPLAY(TEXT("GameEventManager:AddAsyncLambdaListener, Receiver cannot be null for Lambda listener"));
+		return FGameEventListenerHandle();
+	}
 
+	// Only the property wrapper is kept, the typed fast path reads the sender's stack and cannot leave its call
 	FListenerContext Listener;
+	TFunction<void(const void*)> TypedLambdaFunction;
+	uint64 TypedPayloadId = 0;
+	FGameEventPropertyHelper::CreateListenerWrappersFromLambda(std::forward<Lambda>(InLambda),
+	                                                           Listener.LambdaFunction,
+	                                                           TypedLambdaFunction,
+	                                                           TypedPayloadId);
+
 	Listener.Receiver = Receiver;
-	Listener.LambdaFunction = WrapperLambda;
-	Listener.FunctionName = FunctionName;
+	Listener.LambdaId = LambdaListenerIdCounter.fetch_add(1);
+	Listener.Execution = PipeName.IsNone() ? EGameEventExecution::AnyThread : EGameEventExecution::Pipe;
+	Listener.PipeName = PipeName;
+	Listener.SetTagFilter(TagFilter);
+	Listener.SetPayloadPredicates(PayloadPredicates);
+	Listener.Priority = Priority;
+
+	return AddListener(EventId, Listener);
+}
 
-	AddListener(EventId, Listener);
-	return FunctionName;
+template<typename Lambda>
+FGameEventScopedListenerHandle FGameEventManager::AddScopedLambdaListener(const FEventId& EventId, UObject* Receiver, Lambda&& InLambda)
+{
+	return FGameEventScopedListenerHandle(AsShared(), AddLambdaListener(EventId, Receiver, std::forward<Lambda>(InLambda)));
 }
 
 template<typename... Args>
@@ -193,24 +680,118 @@ bool FGameEventManager::SendEvent(const FEventId& EventId, UObject* WorldContext
 	}
 	else
 	{
-		TArray<FPropertyContext> PropertyContexts;
+		FEventContext EventContext;
+		EventContext.WorldContext = WorldContext;
+		EventContext.EventId = EventId;
+		EventContext.bPinned = bPinned;
 
-		([&](auto&& arg)
+		if (bPinned)
 		{
-			using ArgType = std::decay_t<decltype(arg)>;
+			// Construct the values straight into the manager-owned payload, rvalue arguments are moved instead of copied
+			FGameEventPinnedPayloadRef PinnedPayload = MakePinnedPayload(WorldContext, std::forward<Args>(Params)...);
+			EventContext.PropertyContexts = PinnedPayload->GetPropertyContexts();
+			return SendEventInternal(EventContext, MoveTemp(PinnedPayload));
+		}
+
+		MakePropertyContexts(WorldContext, EventContext.PropertyContexts, std::forward<Args>(Params)...);
+
+		// Native lambda listeners with the same argument list read the values from here without going through FProperty
+		using FTypedPayload = TGameEventTypedPayload<std::decay_t<Args>...>;
+		const typename FTypedPayload::FTuple TypedPayload(Params...);
+		EventContext.TypedPayload = &TypedPayload;
+		EventContext.TypedPayloadId = FTypedPayload::Id;
 
-			// Prevent string literals from crashing
-			static_assert(!std::is_array_v<ArgType> ||
-			              !(std::is_same_v<std::remove_cv_t<std::remove_extent_t<ArgType>>, char> ||
-			                std::is_same_v<std::remove_cv_t<std::remove_extent_t<ArgType>>, wchar_t>),
-			              "❌ You can't use string literals directly TEXT(\"string\") ✅ Please use FString(TEXT(\"string\")) replace!");
+		return SendEvent(EventContext);
+	}
+}
+
+template<typename... Args>
+bool FGameEventManager::QueueEvent(const FEventId& EventId, UObject* WorldContext, const bool bPinned, Args&&... Params)
+{
+	if (!WorldContext || !EventId.IsValid())
+	{
+		return false;
+	}
+
+	FEventContext EventContext;
+	EventContext.WorldContext = WorldContext;
+	EventContext.EventId = EventId;
+	EventContext.bPinned = bPinned;
+	if constexpr (sizeof...(Args) > 0)
+	{
+		MakePropertyContexts(WorldContext, EventContext.PropertyContexts, std::forward<Args>(Params)...);
+	}
+
+	return QueueEvent(EventContext);
+}
 
-			if (FProperty* Property = FGameEventPropertyHelper::GetPropertyForType<ArgType>(WorldContext, arg))
+template<typename... Args>
+bool FGameEventManager::QueueEventFromAnyThread(const EGameEventProducer Producer, const FEventId& EventId, UObject* WorldContext, Args&&... Params)
+{
+	if (!WorldContext || !EventId.IsValid())
+	{
+		return false;
+	}
+
+	FEventContext EventContext;
+	EventContext.WorldContext = WorldContext;
+	EventContext.EventId = EventId;
+	if constexpr (sizeof...(Args) > 0)
+	{
+		MakePropertyContexts(WorldContext, EventContext.PropertyContexts, std::forward<Args>(Params)...);
+	}
+
+	return QueueEventFromAnyThread(Producer, EventContext);
+}
+
+template<typename... Args>
+void FGameEventManager::MakePropertyContexts(UObject* WorldContext, TArray<FPropertyContext>& OutPropertyContexts, Args&&... Params)
+{
+	([&](auto&& arg)
+	{
+		using ArgType = std::decay_t<decltype(arg)>;
+
+		// Prevent string literals from crashing
+		static_assert(!std::is_array_v<ArgType> ||
+		              !(std::is_same_v<std::remove_cv_t<std::remove_extent_t<ArgType>>, char> ||
+		                std::is_same_v<std::remove_cv_t<std::remove_extent_t<ArgType>>, wchar_t>),
+		              "❌ You can't use string literals directly TEXT(\"string\") ✅ Please use FString(TEXT(\"string\")) replace!");
+
+		if (FProperty* Property = FGameEventPropertyHelper::GetPropertyForType<ArgType>(WorldContext, arg))
+		{
+			OutPropertyContexts.Add(FPropertyContext(Property, const_cast<void*>(static_cast<const void*>(&arg))));
+		}
+	}(std::forward<Args>(Params)), ...);
+}
+
+template<typename... Args>
+FGameEventPinnedPayloadRef FGameEventManager::MakePinnedPayload(UObject* WorldContext, Args&&... Params)
+{
+	// Upper bound of the value storage, every value may need up to its alignment in padding
+	constexpr SIZE_T ValuesSize = (0 + ... + (sizeof(std::decay_t<Args>) + alignof(std::decay_t<Args>)));
+
+	FGameEventPinnedPayloadRef PinnedPayload = PinnedPayloadStore.Allocate(ValuesSize);
+	uint8* Cursor = PinnedPayload->GetValues();
+
+	([&](auto&& arg)
+	{
+		using ArgType = std::decay_t<decltype(arg)>;
+
+		if (FProperty* Property = FGameEventPropertyHelper::GetPropertyForType<ArgType>(WorldContext, arg))
+		{
+			uint8* Dest = Align(Cursor, alignof(ArgType));
+			if constexpr (std::is_same_v<ArgType, std::nullptr_t>)
 			{
-				PropertyContexts.Add(FPropertyContext(Property, const_cast<void*>(static_cast<const void*>(&arg))));
+				new(Dest) UObject*(nullptr);
 			}
-		}(std::forward<Args>(Params)), ...);
+			else
+			{
+				new(Dest) ArgType(std::forward<decltype(arg)>(arg));
+			}
+			PinnedPayload->AddValue(Property, Dest);
+			Cursor = Dest + sizeof(ArgType);
+		}
+	}(std::forward<Args>(Params)), ...);
 
-		return SendEventInternal(EventId, WorldContext, bPinned, PropertyContexts);
-	}
+	return PinnedPayload;
 }
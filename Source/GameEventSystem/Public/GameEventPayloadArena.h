@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+
+class FReferenceCollector;
+
+/**
+ * Bump allocator for event payloads.
+ * Values are deep-copied with their FProperty layout, Reset() rewinds every block without returning memory to the heap.
+ */
+class GAMEEVENTSYSTEM_API FGameEventPayloadArena
+{
+public:
+	explicit FGameEventPayloadArena(const SIZE_T InBlockSize = 64 * 1024);
+	~FGameEventPayloadArena();
+
+	FGameEventPayloadArena(const FGameEventPayloadArena&) = delete;
+	FGameEventPayloadArena& operator=(const FGameEventPayloadArena&) = delete;
+
+	void* Allocate(const SIZE_T Size, const uint32 Alignment);
+
+	/**
+	 * Deep copy a property value into the arena
+	 * @return Context pointing at the arena copy, or an empty context if the source is invalid
+	 */
+	FPropertyContext CopyProperty(const FPropertyContext& Source);
+
+	/** Destroy a value created by CopyProperty, the memory itself is reclaimed by Reset() */
+	static void DestroyProperty(const FPropertyContext& Context);
+
+	/** Report the objects a copied value references, so they outlive a payload that waits across frames */
+	static void AddPropertyReferences(FReferenceCollector& Collector, const FPropertyContext& Context);
+
+	void Reset();
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FBlock
+	{
+		uint8* Data;
+		SIZE_T Size;
+		SIZE_T Used;
+	};
+
+	SIZE_T BlockSize;
+
+	TArray<FBlock> Blocks;
+
+	int32 CurrentBlock;
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+#include <atomic>
+
+/**
+ * Payload predicates of one listener, compiled per payload layout.
+ * The first send with a new payload fingerprint resolves every field path to a list of offsets (and object
+ * dereferences) and parses the constants for the field type. Later sends with that layout only walk the offsets from
+ * the PropertyContexts memory and compare, before any parameter frame is built for the listener.
+ */
+class GAMEEVENTSYSTEM_API FGameEventCompiledPredicate
+{
+public:
+	explicit FGameEventCompiledPredicate(const TArray<FGameEventPayloadPredicate>& InPredicates);
+
+	/**
+	 * @param PayloadFingerprint FGameEventFunctionLayout::GetPayloadFingerprint of PropertyContexts
+	 * @return Whether every predicate holds, false if a predicate does not apply to this payload
+	 */
+	bool Evaluate(const TArray<FPropertyContext>& PropertyContexts, const uint64 PayloadFingerprint, const UObject* Receiver) const;
+
+private:
+	/** Step of a field path: optionally follow the object pointer at the cursor, then move by Offset */
+	struct FStep
+	{
+		const FObjectPropertyBase* Dereference = nullptr;
+
+		int32 Offset = 0;
+	};
+
+	struct FFieldAccess
+	{
+		// Payload parameter the walk starts from, INDEX_NONE to start from the receiver
+		int32 ParameterIndex = INDEX_NONE;
+
+		TArray<FStep> Steps;
+
+		const FProperty* Leaf = nullptr;
+	};
+
+	enum class EValueKind : uint8
+	{
+		Number,
+		String,
+		Name,
+		Tag,
+		// Receiver comparisons of fields that are not numbers, Equal and NotEqual through FProperty::Identical
+		Identical
+	};
+
+	struct FCondition
+	{
+		FFieldAccess Field;
+
+		// Set for receiver comparisons
+		FFieldAccess ReceiverField;
+
+		bool bAgainstReceiver = false;
+
+		EValueKind Kind = EValueKind::Number;
+
+		EGameEventPredicateOp Op = EGameEventPredicateOp::Equal;
+
+		double Number = 0.0;
+
+		FString String;
+
+		FName Name;
+
+		FGameplayTag Tag;
+	};
+
+	/** Predicates compiled for one payload layout */
+	struct FProgram
+	{
+		uint64 PayloadFingerprint = 0;
+
+		TArray<FCondition> Conditions;
+
+		// A predicate did not resolve against this layout, the listener never matches it
+		bool bValid = true;
+	};
+
+	const FProgram& FindOrCompile(const TArray<FPropertyContext>& PropertyContexts, const uint64 PayloadFingerprint, const UObject* Receiver) const;
+	bool Compile(const FGameEventPayloadPredicate& Predicate, const TArray<FPropertyContext>& PropertyContexts, const UObject* Receiver, FCondition& OutCondition) const;
+
+	static bool ResolvePath(const FProperty* Root, const UStruct* RootStruct, const FString& Path, FFieldAccess& OutAccess);
+	static const void* Walk(const FFieldAccess& Access, const TArray<FPropertyContext>& PropertyContexts, const UObject* Receiver);
+	static bool ReadNumber(const FProperty* Leaf, const void* Value, double& OutNumber);
+	static bool Test(const FCondition& Condition, const TArray<FPropertyContext>& PropertyContexts, const UObject* Receiver);
+
+	TArray<FGameEventPayloadPredicate> Predicates;
+
+	// Guards Programs, a program is never freed or modified once published
+	mutable FCriticalSection ProgramCriticalSection;
+
+	mutable TArray<TUniquePtr<FProgram>> Programs;
+
+	// Program of the last layout seen, most listeners only ever see one
+	mutable std::atomic<const FProgram*> LastProgram {nullptr};
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+#include "Templates/RefCounting.h"
+#include "UObject/GCObject.h"
+#include <atomic>
+
+class FGameEventPinnedPayloadStore;
+
+/**
+ * Owned copy of a pinned event's parameters.
+ * The header and the values share one allocation of the store, the last reference destroys the values and returns
+ * the allocation, so a listener dispatched from a pinned payload stays valid even if the event is unpinned meanwhile.
+ */
+class GAMEEVENTSYSTEM_API FGameEventPinnedPayload
+{
+public:
+	const TArray<FPropertyContext>& GetPropertyContexts() const
+	{
+		return PropertyContexts;
+	}
+
+	/** Start of the value storage */
+	uint8* GetValues()
+	{
+		return reinterpret_cast<uint8*>(this) + HeaderSize;
+	}
+
+	SIZE_T GetValuesSize() const
+	{
+		return ValuesSize;
+	}
+
+	/** Record a value constructed inside the value storage, ownership passes to the payload */
+	void AddValue(FProperty* Property, void* Value);
+
+	uint32 AddRef() const
+	{
+		return static_cast<uint32>(RefCount.fetch_add(1, std::memory_order_relaxed) + 1);
+	}
+
+	uint32 Release() const;
+
+	uint32 GetRefCount() const
+	{
+		return static_cast<uint32>(RefCount.load(std::memory_order_relaxed));
+	}
+
+private:
+	friend class FGameEventPinnedPayloadStore;
+
+	FGameEventPinnedPayload(FGameEventPinnedPayloadStore& InStore, const int32 InSizeClass, const SIZE_T InValuesSize);
+	~FGameEventPinnedPayload();
+
+	static constexpr SIZE_T HeaderSize = 64;
+
+	mutable std::atomic<int32> RefCount;
+
+	FGameEventPinnedPayloadStore& Store;
+
+	int32 SizeClass;
+
+	SIZE_T ValuesSize;
+
+	TArray<FPropertyContext> PropertyContexts;
+
+	// Live payloads of the store, walked by the garbage collector
+	FGameEventPinnedPayload* PrevLive;
+	FGameEventPinnedPayload* NextLive;
+};
+
+using FGameEventPinnedPayloadRef = TRefCountPtr<FGameEventPinnedPayload>;
+
+/**
+ * Manager-owned storage of pinned payloads.
+ * Payloads are carved from 64 KB blocks in power-of-two size classes and recycled through per-class free lists, so
+ * pinning and unpinning thousands of events does not fragment the heap. Oversized payloads fall back to the heap.
+ * The objects referenced by live payloads are reported to the garbage collector, a payload keeps them alive for as
+ * long as it is pinned, backlogged or read by an async listener.
+ */
+class GAMEEVENTSYSTEM_API FGameEventPinnedPayloadStore : public FGCObject
+{
+public:
+	FGameEventPinnedPayloadStore();
+	~FGameEventPinnedPayloadStore();
+
+	FGameEventPinnedPayloadStore(const FGameEventPinnedPayloadStore&) = delete;
+	FGameEventPinnedPayloadStore& operator=(const FGameEventPinnedPayloadStore&) = delete;
+
+	/** Deep copy every valid value of a payload, using its FProperty layout */
+	FGameEventPinnedPayloadRef Copy(const TArray<FPropertyContext>& Source);
+
+	/**
+	 * Reserve an empty payload with ValuesSize bytes of 16-byte aligned value storage.
+	 * Values are constructed by the caller and registered with AddValue.
+	 */
+	FGameEventPinnedPayloadRef Allocate(const SIZE_T ValuesSize);
+
+	/** Bytes currently held in blocks, used or free */
+	SIZE_T GetAllocatedSize() const;
+
+	int32 GetNumPayloads() const
+	{
+		return NumPayloads.load(std::memory_order_relaxed);
+	}
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
+private:
+	friend class FGameEventPinnedPayload;
+
+	static constexpr int32 MinSizeClassShift = 7;
+	static constexpr int32 NumSizeClasses = 10;
+	static constexpr SIZE_T BlockSize = 64 * 1024;
+
+	static int32 GetSizeClass(const SIZE_T Size);
+
+	void Free(FGameEventPinnedPayload* Payload);
+
+	// Guards the free lists, the blocks and the live payload list with the values recorded in it
+	mutable FCriticalSection CriticalSection;
+
+	FGameEventPinnedPayload* LivePayloads;
+
+	// Intrusive list of the chunks returned by Free, per size class
+	void* FreeLists[NumSizeClasses];
+
+	TArray<uint8*> Blocks;
+
+	// Unused tail of the newest block
+	uint8* BlockCursor;
+	uint8* BlockEnd;
+
+	std::atomic<int32> NumPayloads;
+};
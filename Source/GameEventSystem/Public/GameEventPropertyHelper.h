@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <utility>
 #include <functional>
+#include <atomic>
 #include "Logger.h"
 
 #pragma region "Lambda type derivation tool"
@@ -72,6 +73,59 @@ using TLambdaArgType = typename TLambdaTraits<Lambda>::template ArgType<Index>;
 
 #pragma endregion
 
+#pragma region "Typed payload"
+
+/** FNV-1a over a compiler-generated signature, evaluated at compile time */
+constexpr uint64 HashTypedPayloadSignature(const char* Signature)
+{
+	uint64 Hash = 14695981039346656037ull;
+	for (; *Signature; ++Signature)
+	{
+		Hash ^= static_cast<uint8>(*Signature);
+		Hash *= 1099511628211ull;
+	}
+	// Zero is reserved for "no typed payload"
+	return Hash != 0 ? Hash : 1;
+}
+
+/**
+ * Compile-time id of a native argument list.
+ * Derived from the type names rather than the address of a static, so a sender and a listener built into different
+ * modules agree on the id of the same argument list.
+ */
+template<typename... Args>
+constexpr uint64 GetTypedPayloadId()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	return HashTypedPayloadSignature(__FUNCSIG__);
+#else
+	return HashTypedPayloadSignature(__PRETTY_FUNCTION__);
+#endif
+}
+
+/**
+ * Native payload of a C++ send: references to the sender's arguments, valid for the duration of the send.
+ * Listeners whose decayed argument list matches Args read the values straight from the tuple.
+ */
+template<typename... Args>
+struct TGameEventTypedPayload
+{
+	using FTuple = TTuple<const Args&...>;
+
+	static constexpr uint64 Id = GetTypedPayloadId<Args...>();
+};
+
+template<typename Lambda, typename Indices = std::make_index_sequence<TLambdaArgsCount<Lambda>>>
+struct TLambdaTypedPayload;
+
+template<typename Lambda, size_t... Indices>
+struct TLambdaTypedPayload<Lambda, std::index_sequence<Indices...>>
+{
+	using Type = TGameEventTypedPayload<std::decay_t<TLambdaArgType<Lambda, Indices>>...>;
+};
+
+#pragma endregion
+
 #pragma region "TypeTraits"
 template<typename T, typename = void>
 struct THasStaticClass : std::false_type
@@ -315,21 +369,121 @@ struct TPropertyMatcher<TMap<KeyType, ValueType>>
 	}
 };
 
+/**
+ * Owner of the properties generated for native payload types.
+ * Each type gets one slot (a static of its template instantiation), the property is created on first use and
+ * reused by every later send, so sending no longer allocates a property. Properties live until module shutdown.
+ * They are owned by a transient struct of the cache that nothing else links or iterates, and only created under its lock.
+ */
+class GAMEEVENTSYSTEM_API FGameEventPropertyCache
+{
+public:
+	struct FSlot
+	{
+		std::atomic<FProperty*> Property { nullptr };
+
+		// Cache generation the property was created in, a stale slot is rebuilt after the cache is reset
+		std::atomic<uint32> Generation { 0 };
+	};
+
+	/** Cache of the native sends. Separate instances are only meant for tests, a slot must stick to one cache */
+	FGameEventPropertyCache();
+	~FGameEventPropertyCache();
+
+	FGameEventPropertyCache(const FGameEventPropertyCache&) = delete;
+	FGameEventPropertyCache& operator=(const FGameEventPropertyCache&) = delete;
+
+	static FGameEventPropertyCache& Get();
+
+	template<typename Factory>
+	FProperty* FindOrCreate(FSlot& Slot, Factory&& CreateProperty)
+	{
+		const uint32 CurrentGeneration = Generation.load(std::memory_order_acquire);
+		if (Slot.Generation.load(std::memory_order_acquire) == CurrentGeneration)
+		{
+			return Slot.Property.load(std::memory_order_relaxed);
+		}
+
+		FScopeLock Lock(&CriticalSection);
+		if (Slot.Generation.load(std::memory_order_relaxed) != Generation.load(std::memory_order_relaxed))
+		{
+			FProperty* Property = CreateProperty(GetOwner());
+			if (Property)
+			{
+				Properties.Add(Property);
+			}
+			Slot.Property.store(Property, std::memory_order_relaxed);
+			Slot.Generation.store(Generation.load(std::memory_order_relaxed), std::memory_order_release);
+		}
+		return Slot.Property.load(std::memory_order_relaxed);
+	}
+
+	/** Number of properties currently owned by the cache */
+	int32 Num() const;
+
+	/** Number of properties linked into the owner struct, each is unlinked before it is deleted */
+	int32 NumLinked() const;
+
+	/** Delete every cached property, only call once no payload references them */
+	void Reset();
+
+private:
+	// Called with CriticalSection held, creates the owner struct on first use
+	FFieldVariant GetOwner();
+
+	mutable FCriticalSection CriticalSection;
+
+	// Rooted transient struct owning the properties, never linked, so no reflection walk ever reaches them
+	UStruct* Owner;
+
+	TArray<FProperty*> Properties;
+
+	// Starts at 1 so zero-initialized slots are stale
+	std::atomic<uint32> Generation;
+};
+
 class GAMEEVENTSYSTEM_API FGameEventPropertyHelper
 {
 public:
 	template<typename T>
 	static constexpr bool IsTypeSupported();
 
+	/** Property describing T, shared by every send of that type. Context is only checked for validity */
 	template<typename T>
 	static FProperty* GetPropertyForType(const UObject* Context, const T& PropertyPtr);
 
+	/** Property describing T, created on first use and owned by FGameEventPropertyCache */
+	template<typename T>
+	static FProperty* GetCachedPropertyForType();
+
+	/** Build a new property describing T, the caller owns the result */
+	template<typename T>
+	static FProperty* CreatePropertyForType(const FFieldVariant& Owner, const FString& PropertyName);
+
 	template<typename... Args, typename Lambda>
 	static auto CreatePropertyWrapper(Lambda&& InLambda);
 
 	template<typename Lambda>
 	static auto CreatePropertyWrapperFromLambda(Lambda&& InLambda);
 
+	/**
+	 * Wrapper invoking the lambda with a TGameEventTypedPayload matching its decayed argument list.
+	 * The caller has already compared the payload id, no type check happens here.
+	 */
+	template<typename... Args, typename Lambda>
+	static auto CreateTypedWrapper(Lambda&& InLambda);
+
+	/**
+	 * Build both listener wrappers of a lambda around one shared instance, so state it captures by value is the same
+	 * whichever path delivers the event
+	 * @param OutTypedPayloadId Id of the lambda's decayed argument list, compared against TGameEventTypedPayload::Id
+	 */
+	template<typename Lambda>
+	static void CreateListenerWrappersFromLambda(Lambda&& InLambda,
+	                                             TFunction<void(const FPropertyContext&)>& OutPropertyWrapper,
+	                                             TFunction<void(const void*)>& OutTypedWrapper,
+	                                             uint64& OutTypedPayloadId);
+
 private:
 	template<typename... Args, typename Lambda, size_t... Indices>
 	static void ExtractAndInvokeVariadicLambda(Lambda&& InLambda, const TArray<FPropertyContext>& PropertyContexts, std::index_sequence<Indices...>)
@@ -337,6 +491,34 @@ private:
 		InLambda(ExtractParameterValue<Args>(PropertyContexts[Indices])...);
 	}
 
+	template<typename Lambda, size_t... Indices>
+	static void CreateListenerWrappersFromLambdaHelper(Lambda&& InLambda,
+	                                                   TFunction<void(const FPropertyContext&)>& OutPropertyWrapper,
+	                                                   TFunction<void(const void*)>& OutTypedWrapper,
+	                                                   uint64& OutTypedPayloadId,
+	                                                   std::index_sequence<Indices...>)
+	{
+		using FLambda = std::decay_t<Lambda>;
+		const TSharedRef<FLambda> SharedLambda = MakeShared<FLambda>(std::forward<Lambda>(InLambda));
+		auto Invoke = [SharedLambda](auto&&... Params)
+		{
+			(*SharedLambda)(std::forward<decltype(Params)>(Params)...);
+		};
+
+		OutPropertyWrapper = CreatePropertyWrapper<std::decay_t<TLambdaArgType<FLambda, Indices>>...>(Invoke);
+		if constexpr (sizeof...(Indices) > 0)
+		{
+			OutTypedWrapper = CreateTypedWrapper<std::decay_t<TLambdaArgType<FLambda, Indices>>...>(Invoke);
+			OutTypedPayloadId = TLambdaTypedPayload<FLambda>::Type::Id;
+		}
+		else
+		{
+			// Zero-parameter sends never carry a payload
+			OutTypedWrapper = nullptr;
+			OutTypedPayloadId = 0;
+		}
+	}
+
 	template<typename Lambda, size_t... Indices>
 	static auto CreatePropertyWrapperFromLambdaHelper(Lambda&& InLambda, std::index_sequence<Indices...>)
 	{
@@ -375,12 +557,12 @@ private:
 	}
 
 	template<typename T>
-	static FProperty* CreateBasicProperty(const UObject* Context, const FString& PropertyName)
+	static FProperty* CreateBasicProperty(const FFieldVariant& Owner, const FString& PropertyName)
 	{
 		if constexpr (!std::is_void_v<typename TTypeToPropertyType<T>::PropertyType>)
 		{
 			using PropertyType = typename TTypeToPropertyType<T>::PropertyType;
-			PropertyType* Property = new PropertyType(Context->GetClass(), *PropertyName, RF_Public);
+			PropertyType* Property = new PropertyType(Owner, *PropertyName, RF_Public);
 
 			EPropertyFlags ComputedFlags = CPF_None;
 
@@ -410,14 +592,14 @@ private:
 	}
 
 	template<typename T>
-	static FProperty* CreateEnumProperty(const UObject* Context, const FString& PropertyName)
+	static FProperty* CreateEnumProperty(const FFieldVariant& Owner, const FString& PropertyName)
 	{
 		static_assert(std::is_enum_v<T>, "T must be an enum type");
 
 		UEnum* EnumClass = StaticEnum<T>();
 		if (EnumClass && IsValid(EnumClass))
 		{
-			FEnumProperty* EnumProperty = new FEnumProperty(Context->GetClass(), *PropertyName, RF_Public);
+			FEnumProperty* EnumProperty = new FEnumProperty(Owner, *PropertyName, RF_Public);
 			EnumProperty->SetEnum(EnumClass);
 			
 			if constexpr (sizeof(T) == sizeof(uint8))
@@ -446,11 +628,11 @@ private:
 			return EnumProperty;
 		}
 
-		return CreateBasicProperty<T>(Context, PropertyName);
+		return CreateBasicProperty<T>(Owner, PropertyName);
 	}
 
 	template<typename T>
-	static FProperty* CreateStructProperty(const UObject* Context, const FString& PropertyName)
+	static FProperty* CreateStructProperty(const FFieldVariant& Owner, const FString& PropertyName)
 	{
 		if constexpr (!std::is_void_v<typename TTypeToPropertyType<T>::PropertyType>)
 		{
@@ -460,7 +642,7 @@ private:
 				return nullptr;
 			}
 
-			FStructProperty* Property = new FStructProperty(Context->GetClass(), *PropertyName, RF_Public);
+			FStructProperty* Property = new FStructProperty(Owner, *PropertyName, RF_Public);
 			Property->Struct = StructType;
 			if constexpr (THasBaseStructure<T>::value)
 			{
@@ -480,26 +662,14 @@ private:
 	}
 
 	template<typename T>
-	static FProperty* CreateContainerProperty(const UObject* Context, const FString& PropertyName, const T& ParamValue)
+	static FProperty* CreateContainerProperty(const FFieldVariant& Owner, const FString& PropertyName)
 	{
+		// Inner properties are built from the element types and owned by the container
 		if constexpr (TIsTArray<T>::Value)
 		{
 			using ElementType = typename T::ElementType;
-			FArrayProperty* Property = new FArrayProperty(FFieldVariant(Context->GetClass()),
-			                                              *PropertyName,
-			                                              RF_Public);
-			FProperty* ElementProperty = nullptr;
-
-			if (ParamValue.Num() > 0)
-			{
-				ElementProperty = GetPropertyForType<ElementType>(Context, ParamValue[0]);
-			}
-			else
-			{
-				ElementType DefaultElement {};
-				ElementProperty = GetPropertyForType<ElementType>(Context, DefaultElement);
-			}
-
+			FArrayProperty* Property = new FArrayProperty(Owner, *PropertyName, RF_Public);
+			FProperty* ElementProperty = CreatePropertyForType<ElementType>(Property, GetPropertyNameForType<ElementType>());
 			if (!ElementProperty)
 			{
 				delete Property;
@@ -515,21 +685,8 @@ private:
 		else if constexpr (TIsTSet<T>::Value)
 		{
 			using ElementType = typename T::ElementType;
-			FSetProperty* Property = new FSetProperty(FFieldVariant(Context->GetClass()),
-			                                          *PropertyName,
-			                                          RF_Public);
-			FProperty* ElementProperty = nullptr;
-			if (ParamValue.Num() > 0)
-			{
-				auto Iterator = ParamValue.CreateConstIterator();
-				ElementProperty = GetPropertyForType<ElementType>(Context, *Iterator);
-			}
-			else
-			{
-				ElementType DefaultElement {};
-				ElementProperty = GetPropertyForType<ElementType>(Context, DefaultElement);
-			}
-
+			FSetProperty* Property = new FSetProperty(Owner, *PropertyName, RF_Public);
+			FProperty* ElementProperty = CreatePropertyForType<ElementType>(Property, GetPropertyNameForType<ElementType>());
 			if (!ElementProperty)
 			{
 				delete Property;
@@ -548,28 +705,13 @@ private:
 			using KeyType = typename T::KeyType;
 			using ValueType = typename T::ValueType;
 
-			FMapProperty* Property = new FMapProperty(FFieldVariant(Context->GetClass()), *PropertyName, RF_Public);
-
-			FProperty* KeyProperty = nullptr;
-			FProperty* ValueProperty = nullptr;
-
-			if (ParamValue.Num() > 0)
-			{
-				auto Iterator = ParamValue.CreateConstIterator();
-				KeyProperty = GetPropertyForType<KeyType>(Context, Iterator.Key());
-				ValueProperty = GetPropertyForType<ValueType>(Context, Iterator.Value());
-			}
-			else
-			{
-				// Create default properties for empty containers
-				KeyType DefaultKey {};
-				ValueType DefaultValue {};
-				KeyProperty = GetPropertyForType<KeyType>(Context, DefaultKey);
-				ValueProperty = GetPropertyForType<ValueType>(Context, DefaultValue);
-			}
-
+			FMapProperty* Property = new FMapProperty(Owner, *PropertyName, RF_Public);
+			FProperty* KeyProperty = CreatePropertyForType<KeyType>(Property, GetPropertyNameForType<KeyType>());
+			FProperty* ValueProperty = CreatePropertyForType<ValueType>(Property, GetPropertyNameForType<ValueType>());
 			if (!KeyProperty || !ValueProperty)
 			{
+				delete KeyProperty;
+				delete ValueProperty;
 				delete Property;
 				return nullptr;
 			}
@@ -671,7 +813,8 @@ public:
 		{
 			return TEXT("StructValue");
 		}
-		else if constexpr (std::is_pointer_v<T> && std::is_base_of_v<UObject, std::remove_pointer_t<T>>)
+		else if constexpr (std::is_same_v<T, std::nullptr_t> ||
+		                   (std::is_pointer_v<T> && std::is_base_of_v<UObject, std::remove_pointer_t<T>>))
 		{
 			return TEXT("ObjectValue");
 		}
@@ -708,34 +851,63 @@ FProperty* FGameEventPropertyHelper::GetPropertyForType(const UObject* Context,
 		return nullptr;
 	}
 
+	return GetCachedPropertyForType<T>();
+}
+
+template<typename T>
+FProperty* FGameEventPropertyHelper::GetCachedPropertyForType()
+{
+	if constexpr (!std::is_void_v<typename TTypeToPropertyType<T>::PropertyType>)
+	{
+		static FGameEventPropertyCache::FSlot Slot;
+		return FGameEventPropertyCache::Get().FindOrCreate(Slot, [](const FFieldVariant& Owner)
+		{
+			return CreatePropertyForType<T>(Owner, GetPropertyNameForType<T>());
+		});
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template<typename T>
+FProperty* FGameEventPropertyHelper::CreatePropertyForType(const FFieldVariant& Owner, const FString& PropertyName)
+{
 	if constexpr (!std::is_void_v<typename TTypeToPropertyType<T>::PropertyType>)
 	{
 		using PropertyType = typename TTypeToPropertyType<T>::PropertyType;
-		const FString PropertyName = GetPropertyNameForType<T>();
 
 		if constexpr (std::is_same_v<PropertyType, FStructProperty>)
 		{
-			return CreateStructProperty<T>(Context, PropertyName);
+			return CreateStructProperty<T>(Owner, PropertyName);
 		}
 		else if constexpr (std::is_same_v<PropertyType, FObjectProperty>)
 		{
-			FObjectProperty* Property = new FObjectProperty(FFieldVariant(Context->GetClass()), *PropertyName, RF_Public);
-			Property->SetPropertyClass(std::remove_pointer_t<T>::StaticClass());
+			FObjectProperty* Property = new FObjectProperty(Owner, *PropertyName, RF_Public);
+			if constexpr (std::is_same_v<T, std::nullptr_t>)
+			{
+				Property->SetPropertyClass(UObject::StaticClass());
+			}
+			else
+			{
+				Property->SetPropertyClass(std::remove_pointer_t<T>::StaticClass());
+			}
 			return Property;
 		}
 		else if constexpr (std::is_same_v<PropertyType, FArrayProperty> ||
 		                   std::is_same_v<PropertyType, FSetProperty> ||
 		                   std::is_same_v<PropertyType, FMapProperty>)
 		{
-			return CreateContainerProperty<T>(Context, PropertyName, PropertyPtr);
+			return CreateContainerProperty<T>(Owner, PropertyName);
 		}
 		else if constexpr (std::is_enum_v<T>)
 		{
-			return CreateEnumProperty<T>(Context, PropertyName);
+			return CreateEnumProperty<T>(Owner, PropertyName);
 		}
 		else
 		{
-			return CreateBasicProperty<T>(Context, PropertyName);
+			return CreateBasicProperty<T>(Owner, PropertyName);
 		}
 	}
 	else
@@ -816,6 +988,29 @@ auto FGameEventPropertyHelper::CreatePropertyWrapper(Lambda&& InLambda)
 	};
 }
 
+template<typename... Args, typename Lambda>
+auto FGameEventPropertyHelper::CreateTypedWrapper(Lambda&& InLambda)
+{
+	return [InLambda](const void* TypedPayload) mutable -> void
+	{
+		using FTuple = typename TGameEventTypedPayload<Args...>::FTuple;
+		static_cast<const FTuple*>(TypedPayload)->ApplyAfter(InLambda);
+	};
+}
+
+template<typename Lambda>
+void FGameEventPropertyHelper::CreateListenerWrappersFromLambda(Lambda&& InLambda,
+                                                                TFunction<void(const FPropertyContext&)>& OutPropertyWrapper,
+                                                                TFunction<void(const void*)>& OutTypedWrapper,
+                                                                uint64& OutTypedPayloadId)
+{
+	CreateListenerWrappersFromLambdaHelper(std::forward<Lambda>(InLambda),
+	                                       OutPropertyWrapper,
+	                                       OutTypedWrapper,
+	                                       OutTypedPayloadId,
+	                                       std::make_index_sequence<TLambdaArgsCount<std::decay_t<Lambda>>> {});
+}
+
 template<typename Lambda>
 auto FGameEventPropertyHelper::CreatePropertyWrapperFromLambda(Lambda&& InLambda)
 {
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+#include "GameEventPayloadArena.h"
+#include "GameEventPinnedPayloadStore.h"
+#include "GameEventSystemSettings.h"
+#include "UObject/GCObject.h"
+#include <atomic>
+
+struct GAMEEVENTSYSTEM_API FGameEventLaneStats
+{
+	// Events waiting for a later flush
+	int32 NumBacklogged = 0;
+	uint64 NumDelivered = 0;
+	// Events that did not fit the budget of the flush they were due in
+	uint64 NumCarriedOver = 0;
+	// Events delivered over budget because they reached the lane's max latency
+	uint64 NumForced = 0;
+	// Time from Enqueue to the flush that delivered the event
+	double AverageLatencySeconds = 0.0;
+	double LastFlushMaxLatencySeconds = 0.0;
+	// Queue time of the oldest backlogged event at the last flush
+	double OldestBackloggedSeconds = 0.0;
+};
+
+/**
+ * Double-buffered queue of deferred events.
+ * Payloads are deep-copied into the write buffer's arena on Enqueue, Flush swaps the buffers so events
+ * queued by listeners during a flush are delivered on the next flush instead of cascading.
+ * Every event belongs to a lane, lanes are flushed in EGameEventLane order, each within its own time budget. Events
+ * over budget move to the lane's backlog with their payload copied out of the arena, and are delivered first by the
+ * next flushes, or right away once they have waited for the lane's max latency.
+ * Queued payloads keep the objects they reference alive until delivery, world contexts are only weakly held.
+ */
+class GAMEEVENTSYSTEM_API FGameEventQueue : public FGCObject
+{
+public:
+	FGameEventQueue();
+	~FGameEventQueue();
+
+	void Enqueue(const FEventContext& EventContext);
+
+	/**
+	 * Deliver the pending events the lane budgets allow, grouped by event so listeners of the same event run back to
+	 * back. Order between sends of the same event is preserved, backlogged sends included.
+	 * A flush requested by a listener during a flush is deferred, its events go out with the next one.
+	 * @return Number of events delivered
+	 */
+	int32 Flush(TFunctionRef<void(const FEventContext&)> Dispatch);
+
+	/** Events waiting for a flush, backlogged ones included */
+	int32 Num() const;
+
+	void SetLaneConfig(const EGameEventLane Lane, const FGameEventLaneConfig& Config);
+
+	/** Lane of the later sends of an event, events are in the Gameplay lane unless set otherwise */
+	void SetEventLane(const FGameEventHandle EventHandle, const EGameEventLane Lane);
+	EGameEventLane GetEventLane(const FGameEventHandle EventHandle) const;
+
+	FGameEventLaneStats GetLaneStats(const EGameEventLane Lane) const;
+
+	/**
+	 * Latest-wins coalescing: further sends of the event before the next flush overwrite the pending payload
+	 * in place and the event is delivered once. A send carried over to the backlog is replaced by a newer one too.
+	 */
+	void SetCoalescing(const FGameEventHandle EventHandle, const bool bCoalesce);
+	bool IsCoalescing(const FGameEventHandle EventHandle) const;
+
+	/** Drop every pending event without delivering it */
+	void Reset();
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
+private:
+	struct FBuffer
+	{
+		TArray<FEventContext> Events;
+
+		FGameEventPayloadArena Arena;
+
+		// Index into Events of the pending send of each coalesced event
+		TMap<FGameEventHandle, int32> CoalescedEvents;
+
+		// Parallel to Events. The world may go away before the flush, Events only get the context back on delivery
+		TArray<double> EnqueueSeconds;
+		TArray<EGameEventLane> Lanes;
+		TArray<TWeakObjectPtr<UObject>> WorldContexts;
+	};
+
+	/** Event carried over to a later flush, its values live in the backlog store instead of a buffer arena */
+	struct FBacklogEvent
+	{
+		FEventContext Event;
+
+		FGameEventPinnedPayloadRef Payload;
+
+		// The world may go away while the event waits
+		TWeakObjectPtr<UObject> WorldContext;
+
+		double EnqueueSeconds = 0.0;
+	};
+
+	struct FLane
+	{
+		FGameEventLaneConfig Config;
+
+		// Enqueue order within each event
+		TArray<FBacklogEvent> Backlog;
+
+		uint64 NumDelivered = 0;
+		uint64 NumCarriedOver = 0;
+		uint64 NumForced = 0;
+		double TotalLatencySeconds = 0.0;
+		double LastFlushMaxLatencySeconds = 0.0;
+		double OldestBackloggedSeconds = 0.0;
+	};
+
+	void CarryOver(FLane& Lane, const FEventContext& QueuedEvent, const TWeakObjectPtr<UObject>& WorldContext, const double EnqueueSeconds);
+
+	static void CopyPayload(FBuffer& Buffer, FEventContext& QueuedEvent, const TArray<FPropertyContext>& Source);
+	static bool TryOverwritePayload(FEventContext& QueuedEvent, const TArray<FPropertyContext>& Source);
+	static void ResetBuffer(FBuffer& Buffer);
+
+	// Guards WriteIndex and the write buffer
+	mutable FCriticalSection CriticalSection;
+
+	// Serializes flushes, the read buffer is owned by the flushing thread
+	FCriticalSection FlushCriticalSection;
+
+	// Set while a flush is delivering, guarded by FlushCriticalSection. A nested flush would swap the buffer being read
+	bool bFlushing;
+
+	FBuffer Buffers[2];
+
+	int32 WriteIndex;
+
+	TSet<FGameEventHandle> CoalescingEvents;
+
+	TMap<FGameEventHandle, EGameEventLane> EventLanes;
+
+	// Declared before Lanes so it outlives the backlogged payloads
+	FGameEventPinnedPayloadStore BacklogStore;
+
+	// Owned by the flushing thread like the read buffer
+	FLane Lanes[static_cast<int32>(EGameEventLane::Count)];
+
+	std::atomic<int32> NumBacklogged;
+};
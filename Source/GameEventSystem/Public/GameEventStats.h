@@ -0,0 +1,11 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("GameEventSystem"), STATGROUP_GameEventSystem, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ParamsBuffer Heap Allocations"), STAT_GameEvent_ParamsBufferHeapAllocs, STATGROUP_GameEventSystem, GAMEEVENTSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sends With No Listeners"), STAT_GameEvent_SendsWithNoListeners, STATGROUP_GameEventSystem, GAMEEVENTSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Purged Listeners Of Dead Receivers"), STAT_GameEvent_PurgedListeners, STATGROUP_GameEventSystem, GAMEEVENTSYSTEM_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queued Events Carried Over"), STAT_GameEvent_QueueCarriedOver, STATGROUP_GameEventSystem, GAMEEVENTSYSTEM_API);
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class FGameEventQueueTicker;
+
 class FGameEventSystemModule : public IModuleInterface
 {
 public:
@@ -10,6 +12,11 @@ public:
 	virtual void ShutdownModule() override;
 
 private:
+	// Delivers events queued with FGameEventManager::QueueEvent
+	TSharedPtr<FGameEventQueueTicker> QueueTicker;
+
+	FDelegateHandle PostGarbageCollectDelegate;
+
 #if WITH_EDITOR
 	FDelegateHandle BeginPieDelegate;
 #endif
@@ -4,6 +4,79 @@
 #include "Engine/DeveloperSettings.h"
 #include "GameEventSystemSettings.generated.h"
 
+/** Point in the frame where queued events are delivered */
+UENUM(BlueprintType)
+enum class EGameEventQueueFlushPoint : uint8
+{
+	// Before any actor or component ticks
+	WorldTickStart UMETA(DisplayName = "World Tick Start"),
+	// After every tick group of the world has run
+	PostActorTick UMETA(DisplayName = "Post Actor Tick"),
+	// With the tickable objects, after the world tick
+	EndOfFrame UMETA(DisplayName = "End Of Frame")
+};
+
+/** Class of thread that sends events through QueueEventFromAnyThread, each class has its own ring */
+UENUM(BlueprintType)
+enum class EGameEventProducer : uint8
+{
+	Task,
+	Physics,
+	Loading,
+	Other,
+	Count UMETA(Hidden)
+};
+
+/** What a producer does when its ring is full */
+UENUM(BlueprintType)
+enum class EGameEventOverflowPolicy : uint8
+{
+	// Wait until the game thread drains a slot
+	Block,
+	// Discard the oldest undelivered event to make room
+	DropOldest,
+	// Discard the event being sent
+	DropNewest
+};
+
+/** Flush lane of queued events, lanes are flushed in this order and each has its own frame budget */
+UENUM(BlueprintType)
+enum class EGameEventLane : uint8
+{
+	Critical,
+	Gameplay,
+	UI,
+	Cosmetic,
+	Count UMETA(Hidden)
+};
+
+USTRUCT(BlueprintType)
+struct GAMEEVENTSYSTEM_API FGameEventLaneConfig
+{
+	GENERATED_BODY()
+
+	/** Time the lane may spend delivering per flush, 0 for no limit. Events over budget carry over to the next flushes */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Queue", meta = (ClampMin = "0", Units = "Microseconds"))
+	int32 BudgetMicroseconds = 0;
+
+	/** Events queued for longer are delivered even over budget, 0 to let them wait */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Queue", meta = (ClampMin = "0", Units = "Milliseconds"))
+	float MaxLatencyMilliseconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct GAMEEVENTSYSTEM_API FGameEventProducerQueueConfig
+{
+	GENERATED_BODY()
+
+	// Rounded up to a power of two
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Queue", meta = (ClampMin = "2"))
+	int32 Capacity = 1024;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Queue")
+	EGameEventOverflowPolicy OverflowPolicy = EGameEventOverflowPolicy::DropOldest;
+};
+
 UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Game Event System"))
 class GAMEEVENTSYSTEM_API UGameEventSystemSettings : public UDeveloperSettings
 {
@@ -28,4 +101,19 @@ public:
 
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Debug", meta = (DisplayName = "Enable Node Debug Log", ToolTip = "Enable blueprint node debugging log"))
 	bool bEnableNodeDebug;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Queue", meta = (DisplayName = "Queue Flush Point", ToolTip = "When events sent with QueueEvent are delivered each frame"))
+	EGameEventQueueFlushPoint QueueFlushPoint;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Queue", meta = (DisplayName = "Producer Queues", ToolTip = "Capacity and overflow policy of the ring used by each producer class, read when the event manager is created"))
+	TMap<EGameEventProducer, FGameEventProducerQueueConfig> ProducerQueues;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Queue", meta = (DisplayName = "Queue Lanes", ToolTip = "Frame budget and maximum latency of each lane of QueueEvent, read when the event manager is created"))
+	TMap<EGameEventLane, FGameEventLaneConfig> QueueLanes;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bus", meta = (DisplayName = "Per-World Event Buses", ToolTip = "Give every world its own event bus, Blueprint nodes and FGameEventManager::Get(WorldContext) route to the bus of the context's world. Read when a world is created"))
+	bool bPerWorldEventBuses;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Listener", meta = (DisplayName = "Max Purged Listeners Per Frame", ClampMin = "0", ToolTip = "Listeners of receivers destroyed by garbage collection removed per frame, the rest waits for the next frames. 0 removes them all at once"))
+	int32 MaxPurgedListenersPerFrame;
 };
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+
+/**
+ * Flat event table of one manager shard, guarded by the shard lock.
+ * Handles map to record indices through an open-addressing slot array (linear probing on the handle id).
+ * Every record is split in parallel arrays: the hot part read on each send, the cold FEventContext and the listener index. Removing an event leaves a tombstone in its slot and puts its record on a free list, the next event
+ * added revives it with its listener capacity instead of allocating a new one, so records never outnumber the peak of
+ * live events. Slots are rehashed in place once tombstones take a quarter of them.
+ * Listeners are indexed by FGameEventListenerKey and grouped in one bucket per priority. Only the buckets are sorted, by
+ * descending priority, so a send dispatches in priority order without sorting. Adding appends to the bucket and removing
+ * moves the bucket's last listener into the hole, both constant time whatever the number of listeners; the order within
+ * a priority is therefore not kept. The table only holds listener handles, the listeners themselves are owned by the
+ * shard's FGameEventListenerPool.
+ */
+class GAMEEVENTSYSTEM_API FGameEventTable
+{
+public:
+	/** Part of a record touched by every send */
+	struct FHotRecord
+	{
+		/** Published after every change of the record's listeners, never modified in place */
+		FListenerSnapshot ListenerSnapshot;
+
+		bool bPinned = false;
+
+		// The event name is a wildcard pattern, its listeners are mirrored into the manager's FGameEventWildcardIndex
+		bool bWildcard = false;
+
+		bool bLive = false;
+	};
+
+	FGameEventTable();
+
+	/** @return Index of the live record of the event, INDEX_NONE if the event does not exist */
+	int32 Find(const FGameEventHandle EventHandle) const;
+
+	/**
+	 * Find the live record of an event, reviving a free record or adding one if needed.
+	 * May add a record, indices stay valid but references to records do not.
+	 */
+	int32 FindOrAdd(const FEventId& EventId, bool& bOutAdded);
+
+	/**
+	 * Mark the record dead and free its slot, the record and its listener capacity are kept for the next FindOrAdd.
+	 * The caller frees the handles of the remaining listeners first.
+	 */
+	void Remove(const int32 Index);
+
+	/** Add a listener to the bucket of its priority, the caller checks with FindListener that its key is not registered yet */
+	void AddListener(const int32 Index, const FGameEventListenerKey& Key, const FGameEventListenerHandle ListenerHandle, const int32 Priority);
+
+	/** @return Handle of the listener registered with Key, invalid if there is none */
+	FGameEventListenerHandle FindListener(const int32 Index, const FGameEventListenerKey& Key) const;
+
+	/** @return Handle of the removed listener, invalid if the listener was not registered */
+	FGameEventListenerHandle RemoveListener(const int32 Index, const FGameEventListenerKey& Key);
+
+	/**
+	 * Remove every listener ShouldRemove returns true for, it is called with each listener handle
+	 * @param OutRemoved Handles of the removed listeners, to be freed in the listener pool
+	 */
+	template<typename Predicate>
+	void RemoveListenersIf(const int32 Index, Predicate&& ShouldRemove, TArray<FGameEventListenerHandle>& OutRemoved)
+	{
+		FListenerIndex& Indices = ListenerIndices[Index];
+		for (int32 BucketIndex = Indices.Buckets.Num() - 1; BucketIndex >= 0; --BucketIndex)
+		{
+			// Backwards, a removal only moves a listener that was already visited and only drops an emptied bucket
+			for (int32 ListenerIndex = Indices.Buckets[BucketIndex].Listeners.Num() - 1; ListenerIndex >= 0; --ListenerIndex)
+			{
+				if (ShouldRemove(Indices.Buckets[BucketIndex].Listeners[ListenerIndex]))
+				{
+					OutRemoved.Add(RemoveFromBucket(Indices, BucketIndex, ListenerIndex));
+				}
+			}
+		}
+	}
+
+	/** Call Visitor with each listener handle of the event in dispatch order */
+	template<typename Visitor>
+	void ForEachListener(const int32 Index, Visitor&& Visit) const
+	{
+		for (const FBucket& Bucket : ListenerIndices[Index].Buckets)
+		{
+			for (const FGameEventListenerHandle ListenerHandle : Bucket.Listeners)
+			{
+				Visit(ListenerHandle);
+			}
+		}
+	}
+
+	int32 NumListeners(const int32 Index) const
+	{
+		return ListenerIndices[Index].NumListeners;
+	}
+
+	/** Listener counts of the event per priority, highest priority first */
+	void GetPriorityBuckets(const int32 Index, TArray<FGameEventPriorityBucket>& OutBuckets) const;
+
+	FHotRecord& GetHot(const int32 Index)
+	{
+		return HotRecords[Index];
+	}
+
+	/** Stored event, bPinned and the listener snapshot of a stored event live in its hot record, its listeners in the listener index */
+	FEventContext& GetEvent(const int32 Index)
+	{
+		return Events[Index];
+	}
+
+	/** Number of live events */
+	int32 Num() const
+	{
+		return NumLive;
+	}
+
+	/** Free every record and slot */
+	void Empty();
+
+private:
+	// Slot of a removed event, probes continue past it. Handle ids are allocated from 1 and never get this far
+	static constexpr uint32 TombstoneId = MAX_uint32;
+
+	struct FSlot
+	{
+		// Zero marks an empty slot, it is never a valid handle id
+		uint32 HandleId = 0;
+
+		int32 Index = INDEX_NONE;
+	};
+
+	uint32 GetHomeSlot(const uint32 HandleId) const
+	{
+		// Fibonacci hashing keeps the high bits: the low bits of the ids in one shard are all the same
+		return (HandleId * 0x9E3779B9u) >> SlotShift;
+	}
+
+	/** Listeners of one priority in no particular order */
+	struct FBucket
+	{
+		int32 Priority = 0;
+
+		TArray<FGameEventListenerHandle> Listeners;
+
+		// Key each listener was added with, parallel to Listeners, so a listener whose receiver died is still found
+		TArray<FGameEventListenerKey> Keys;
+	};
+
+	struct FListenerPosition
+	{
+		int32 Priority = 0;
+
+		// Index in the bucket's Listeners
+		int32 Index = INDEX_NONE;
+	};
+
+	/** Listener index of one record */
+	struct FListenerIndex
+	{
+		TMap<FGameEventListenerKey, FListenerPosition> Positions;
+
+		// Descending priority, no bucket is empty
+		TArray<FBucket> Buckets;
+
+		int32 NumListeners = 0;
+	};
+
+	/** @return Index of the bucket of Priority in Indices.Buckets, INDEX_NONE if there is none */
+	static int32 FindBucket(const FListenerIndex& Indices, const int32 Priority);
+
+	/** Swap-remove a listener from its bucket and drop the bucket once it is empty */
+	static FGameEventListenerHandle RemoveFromBucket(FListenerIndex& Indices, const int32 BucketIndex, const int32 ListenerIndex);
+
+	int32 FindSlot(const uint32 HandleId) const;
+
+	/** Rebuild the slots of the live records into NewNumSlots slots, a power of two, dropping the tombstones */
+	void Rehash(const int32 NewNumSlots);
+
+	TArray<FSlot> Slots;
+
+	uint32 SlotMask;
+
+	uint32 SlotShift;
+
+	TArray<FHotRecord> HotRecords;
+
+	TArray<FEventContext> Events;
+
+	TArray<FListenerIndex> ListenerIndices;
+
+	// Dead records, reused by FindOrAdd
+	TArray<int32> FreeRecords;
+
+	int32 NumLive;
+
+	int32 NumTombstones;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+#include "GameEventSystemSettings.h"
+#include "UObject/GCObject.h"
+#include <atomic>
+
+struct GAMEEVENTSYSTEM_API FGameEventThreadQueueStats
+{
+	uint64 NumPushed = 0;
+	uint64 NumDelivered = 0;
+	uint64 NumDroppedOldest = 0;
+	uint64 NumDroppedNewest = 0;
+	// Pushes that had to wait for a free slot under the Block policy
+	uint64 NumBlocked = 0;
+};
+
+/**
+ * Bounded lock-free multi-producer ring, drained by the game thread.
+ * Every slot carries a sequence number: producers claim a slot with a CAS on the enqueue position and
+ * publish it by bumping the sequence, so a slot is owned by exactly one thread at a time.
+ * The dequeue position is also claimed with a CAS, which lets DropOldest producers evict without a lock.
+ * Producers write and evict slots inside a GC scope guard, so the collector only ever sees published slots and
+ * reports the objects their payloads reference. World contexts are weakly held.
+ */
+class GAMEEVENTSYSTEM_API FGameEventThreadQueue : public FGCObject
+{
+public:
+	FGameEventThreadQueue(const int32 InCapacity, const EGameEventOverflowPolicy InOverflowPolicy);
+	~FGameEventThreadQueue();
+
+	FGameEventThreadQueue(const FGameEventThreadQueue&) = delete;
+	FGameEventThreadQueue& operator=(const FGameEventThreadQueue&) = delete;
+
+	/**
+	 * Copy an event into the ring, callable from any thread
+	 * @param Stamp Global send order, used by the consumer to merge rings
+	 * @return false if the event was dropped
+	 */
+	bool Push(const FEventContext& EventContext, const uint64 Stamp);
+
+	/** Stamp of the oldest published event, MAX_uint64 if nothing is ready. Consumer only */
+	uint64 PeekStamp() const;
+
+	/** Deliver the oldest published event. Consumer only */
+	bool PopAndDispatch(TFunctionRef<void(const FEventContext&)> Dispatch);
+
+	/** Destroy every pending event without delivering it. Consumer only */
+	void Reset();
+
+	EGameEventOverflowPolicy GetOverflowPolicy() const
+	{
+		return OverflowPolicy;
+	}
+
+	FGameEventThreadQueueStats GetStats() const;
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence;
+
+		std::atomic<uint64> Stamp;
+
+		FGameEventHandle EventHandle;
+
+		TWeakObjectPtr<UObject> WorldContext;
+
+		// Payload values are constructed in Payload at the offsets stored in PropertyContexts
+		TArray<FPropertyContext> PropertyContexts;
+
+		TArray<uint8, TAlignedHeapAllocator<16>> Payload;
+	};
+
+	bool TryPush(const FEventContext& EventContext, const uint64 Stamp);
+	FSlot* TryClaimOldest(uint64& OutPosition);
+	void ReleaseSlot(FSlot& Slot, const uint64 Position);
+
+	static void WritePayload(FSlot& Slot, const TArray<FPropertyContext>& Source);
+	static void DestroyPayload(FSlot& Slot);
+
+	FSlot* Slots;
+
+	uint64 Mask;
+
+	EGameEventOverflowPolicy OverflowPolicy;
+
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePosition;
+
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DequeuePosition;
+
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> NumPushed;
+	std::atomic<uint64> NumDelivered;
+	std::atomic<uint64> NumDroppedOldest;
+	std::atomic<uint64> NumDroppedNewest;
+	std::atomic<uint64> NumBlocked;
+};
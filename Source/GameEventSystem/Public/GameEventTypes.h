@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "UObject/WeakObjectPtr.h"
+#include "GameEventIdRegistry.h"
+#include "GameEventFunctionLayout.h"
+#include <atomic>
 #include "GameEventTypes.generated.h"
 
 USTRUCT(BlueprintType)
@@ -50,45 +53,149 @@ struct GAMEEVENTSYSTEM_API FEventId
 	UPROPERTY(BlueprintReadWrite, Category="GameEventSystem")
 	FString Key;
 
-	FEventId() = default;
+	FEventId() : HandleId(0)
+	{
+	}
+
+	/** Ids are only looked up, sending to a name nothing listens to does not grow the registry, see FindOrAddHandle */
+	explicit FEventId(const FString& InStringId) : Key(InStringId),
+	                                              HandleId(FGameEventIdRegistry::Get().Find(InStringId).Id)
+	{
+	}
+
+	/** Build an event id without allocating a Key string when the name is already interned */
+	explicit FEventId(const TCHAR* InStringId) : FEventId(FStringView(InStringId))
+	{
+	}
+
+	explicit FEventId(const FStringView InStringId) : HandleId(FGameEventIdRegistry::Get().Find(InStringId).Id)
+	{
+		// An unknown name is kept until something interns it
+		if (HandleId.load(std::memory_order_relaxed) == 0)
+		{
+			Key = FString(InStringId);
+		}
+	}
+
+	explicit FEventId(const FGameplayTag& InTag) : Tag(InTag),
+	                                              HandleId(FGameEventIdRegistry::Get().FindTag(InTag).Id)
+	{
+	}
+
+	explicit FEventId(const FGameEventHandle InHandle) : HandleId(InHandle.Id)
+	{
+	}
+
+	FEventId(const FEventId& Other) : Tag(Other.Tag),
+	                                  Key(Other.Key),
+	                                  HandleId(Other.HandleId.load(std::memory_order_relaxed))
+	{
+	}
+
+	FEventId& operator=(const FEventId& Other)
+	{
+		Tag = Other.Tag;
+		Key = Other.Key;
+		HandleId.store(Other.HandleId.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
 
-	explicit FEventId(const FString& InStringId) : Key(InStringId)
+	/**
+	 * Interned handle of this event, invalid while nothing has interned its name.
+	 * Blueprint thunks write Key directly, so the handle is resolved from Key on first use.
+	 * Lookups are idempotent, so threads racing on the first use all store the same id.
+	 */
+	FGameEventHandle GetHandle() const
 	{
+		uint32 Id = HandleId.load(std::memory_order_relaxed);
+		if (Id == 0)
+		{
+			if (!Key.IsEmpty())
+			{
+				Id = FGameEventIdRegistry::Get().Find(Key).Id;
+			}
+			else if (Tag.IsValid())
+			{
+				Id = FGameEventIdRegistry::Get().FindTag(Tag).Id;
+			}
+			if (Id != 0)
+			{
+				HandleId.store(Id, std::memory_order_relaxed);
+			}
+		}
+		return FGameEventHandle(Id);
 	}
 
-	explicit FEventId(const FGameplayTag& InTag) : Tag(InTag)
+	/** Intern the name of this event, only done for what the manager keeps: listeners, pins and queued events */
+	FGameEventHandle FindOrAddHandle() const
 	{
-		Key = TagToEventName(InTag);
+		uint32 Id = GetHandle().Id;
+		if (Id == 0)
+		{
+			if (!Key.IsEmpty())
+			{
+				Id = FGameEventIdRegistry::Get().FindOrAdd(Key).Id;
+			}
+			else if (Tag.IsValid())
+			{
+				Id = FGameEventIdRegistry::Get().FindOrAddTag(Tag).Id;
+			}
+			HandleId.store(Id, std::memory_order_relaxed);
+		}
+		return FGameEventHandle(Id);
 	}
 
 	FString GetName() const
 	{
-		return Key;
+		if (!Key.IsEmpty())
+		{
+			return Key;
+		}
+		const uint32 Id = HandleId.load(std::memory_order_relaxed);
+		return Id == 0 ? TagToEventName(Tag) : FGameEventIdRegistry::Get().GetName(FGameEventHandle(Id)).ToString();
 	}
 
 	FString ToString() const
 	{
-		return Key;
+		return GetName();
 	}
 
+	/** Whether the id names an event, interned or not */
 	bool IsValid() const
 	{
-		return !Key.IsEmpty();
+		return HandleId.load(std::memory_order_relaxed) != 0 || !Key.IsEmpty() || Tag.IsValid();
 	}
 
+	/** Names nobody interned have no handle and are compared by name, like the registry case-insensitively */
 	bool operator==(const FEventId& Other) const
 	{
-		return Key == Other.Key;
+		const FGameEventHandle Handle = GetHandle();
+		const FGameEventHandle OtherHandle = Other.GetHandle();
+		if (Handle.IsValid() || OtherHandle.IsValid())
+		{
+			return Handle == OtherHandle;
+		}
+		return GetName() == Other.GetName();
 	}
 
 	bool operator!=(const FEventId& Other) const
 	{
-		return Key != Other.Key;
+		return !(*this == Other);
 	}
 
 	friend uint32 GetTypeHash(const FEventId& EventId)
 	{
-		return GetTypeHash(EventId.Key);
+		return GetTypeHash(EventId.GetHandle());
+	}
+
+	/** Wildcard id hearing the tag and all of its descendants, see FGameEventManager::AddListener */
+	static FEventId TagAndDescendants(const FGameplayTag& InTag)
+	{
+		if (!InTag.IsValid())
+		{
+			return FEventId();
+		}
+		return FEventId(TagToEventName(InTag) + TEXT(".**"));
 	}
 
 	/** Convert GameplayTag to event name */
@@ -108,6 +215,130 @@ struct GAMEEVENTSYSTEM_API FEventId
 		}
 		return TagString;
 	}
+
+private:
+	mutable std::atomic<uint32> HandleId;
+};
+
+/**
+ * Tag pre-filter of a listener, tested against the first FGameplayTagContainer or FGameplayTag parameter of a send
+ * before the listener is invoked. Tags match like FGameplayTagContainer::HasTag, parents of the payload tags included.
+ * A send without a tag parameter has no tags.
+ */
+USTRUCT(BlueprintType)
+struct GAMEEVENTSYSTEM_API FGameEventTagFilter
+{
+	GENERATED_BODY()
+
+	/** The payload must have at least one of these tags */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	FGameplayTagContainer RequireAnyTags;
+
+	/** The payload must have all of these tags */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	FGameplayTagContainer RequireAllTags;
+
+	/** The payload must have none of these tags */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	FGameplayTagContainer IgnoreTags;
+
+	/**
+	 * Tested in addition to the tag sets. Queries made of AnyTagsMatch, AllTagsMatch and NoTagsMatch, alone or under
+	 * AllExprMatch, compile to the same bit masks, other queries are evaluated per listener
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	FGameplayTagQuery TagQuery;
+
+	bool IsEmpty() const
+	{
+		return RequireAnyTags.IsEmpty() && RequireAllTags.IsEmpty() && IgnoreTags.IsEmpty() && TagQuery.IsEmpty();
+	}
+
+	/** Reference test of one payload, dispatch evaluates the compiled FGameEventTagFilterTable instead */
+	bool Matches(const FGameplayTagContainer& PayloadTags) const
+	{
+		return (RequireAnyTags.IsEmpty() || PayloadTags.HasAny(RequireAnyTags)) &&
+		       PayloadTags.HasAll(RequireAllTags) &&
+		       !PayloadTags.HasAny(IgnoreTags) &&
+		       (TagQuery.IsEmpty() || TagQuery.Matches(PayloadTags));
+	}
+};
+
+UENUM(BlueprintType)
+enum class EGameEventPredicateOp : uint8
+{
+	Equal,
+	NotEqual,
+	Less,
+	LessOrEqual,
+	Greater,
+	GreaterOrEqual
+};
+
+/**
+ * Condition on one payload field a listener is called for, e.g. Damage > 50 or Team == Receiver.Team.
+ * Compiled once per payload layout into field offsets read straight from the send's parameter memory, see
+ * FGameEventCompiledPredicate. Fields are compared as numbers (numeric, bool and enum fields), strings, names or
+ * gameplay tags, the last two for Equal and NotEqual only.
+ */
+USTRUCT(BlueprintType)
+struct GAMEEVENTSYSTEM_API FGameEventPayloadPredicate
+{
+	GENERATED_BODY()
+
+	/** Index of the event parameter the field belongs to */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	int32 ParameterIndex = 0;
+
+	/** Dot-separated path through struct and object fields of the parameter, empty to compare the parameter itself */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	FString FieldPath;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	EGameEventPredicateOp Op = EGameEventPredicateOp::Equal;
+
+	/** Constant the field is compared with, enum values may be given by name */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	FString Value;
+
+	/** When set, the field is compared with this field path of the receiver instead of Value */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameEventSystem")
+	FString ReceiverFieldPath;
+};
+
+class FGameEventCompiledPredicate;
+
+/** Where a listener runs */
+enum class EGameEventExecution : uint8
+{
+	// Called inline by the sender
+	GameThread,
+	// Launched as a UE::Tasks task
+	AnyThread,
+	// Launched on a named UE::Tasks::FPipe, the tasks of one pipe never run concurrently
+	Pipe
+};
+
+/** Identity of a listener: its receiver and the callable it invokes */
+struct GAMEEVENTSYSTEM_API FGameEventListenerKey
+{
+	TWeakObjectPtr<> Receiver;
+
+	// Function or delegate function name, NAME_None for lambda listeners
+	FName CallableName;
+
+	// Unique id of a lambda listener, 0 otherwise
+	uint64 LambdaId = 0;
+
+	bool operator==(const FGameEventListenerKey& Other) const
+	{
+		return LambdaId == Other.LambdaId && CallableName == Other.CallableName && Receiver == Other.Receiver;
+	}
+
+	friend uint32 GetTypeHash(const FGameEventListenerKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.Receiver), GetTypeHash(Key.CallableName)), GetTypeHash(Key.LambdaId));
+	}
 };
 
 struct GAMEEVENTSYSTEM_API FListenerContext
@@ -115,12 +346,93 @@ struct GAMEEVENTSYSTEM_API FListenerContext
 	TWeakObjectPtr<> Receiver;
 	FString FunctionName;
 	UFunction* Function;
+	// Cached parameter layout of Function, shared by every snapshot of this listener
+	FGameEventFunctionLayoutPtr FunctionLayout;
 	FEventPropertyDelegate PropertyDelegate;
 	TFunction<void(const FPropertyContext&)> LambdaFunction;
+	// Native fast path of a lambda listener, invoked when a send's typed payload id equals TypedPayloadId
+	TFunction<void(const void*)> TypedLambdaFunction;
+	uint64 TypedPayloadId;
+	// Unique id of a lambda listener, 0 for other listeners
+	uint64 LambdaId;
+	// Optional payload tag pre-filter, shared by every snapshot of this listener
+	TSharedPtr<const FGameEventTagFilter, ESPMode::ThreadSafe> TagFilter;
+	// Optional payload field conditions, all of them must hold
+	TSharedPtr<const FGameEventCompiledPredicate, ESPMode::ThreadSafe> PayloadPredicate;
+	// Higher priorities are called first, the order within a priority is not specified
+	int32 Priority;
+	// Lambda listeners only. Off the game thread the lambda gets an immutable copy of the payload and must not touch the receiver
+	EGameEventExecution Execution;
+	// Pipe of an EGameEventExecution::Pipe listener
+	FName PipeName;
+	// LambdaFunction shared with the tasks of an async listener, set by PrepareExecution
+	TSharedPtr<const TFunction<void(const FPropertyContext&)>, ESPMode::ThreadSafe> AsyncLambdaFunction;
 
 	FListenerContext() : Receiver(nullptr),
-	                     Function(nullptr)
+	                     Function(nullptr),
+	                     TypedPayloadId(0),
+	                     LambdaId(0),
+	                     Priority(0),
+	                     Execution(EGameEventExecution::GameThread)
+	{
+	}
+
+	/** Key of the listener in the listener indices, two listeners with the same key are duplicates */
+	FGameEventListenerKey GetKey() const
+	{
+		FGameEventListenerKey Key;
+		Key.Receiver = Receiver;
+		if (LambdaId != 0)
+		{
+			Key.LambdaId = LambdaId;
+		}
+		else if (PropertyDelegate.IsBound())
+		{
+			Key.CallableName = PropertyDelegate.GetFunctionName();
+		}
+		else if (Function)
+		{
+			Key.CallableName = Function->GetFName();
+		}
+		else if (!FunctionName.IsEmpty())
+		{
+			Key.CallableName = FName(*FunctionName);
+		}
+		return Key;
+	}
+
+	/** An empty filter clears it */
+	void SetTagFilter(const FGameEventTagFilter& InTagFilter)
 	{
+		if (InTagFilter.IsEmpty())
+		{
+			TagFilter.Reset();
+		}
+		else
+		{
+			TagFilter = MakeShared<const FGameEventTagFilter, ESPMode::ThreadSafe>(InTagFilter);
+		}
+	}
+
+	/** An empty list clears them */
+	void SetPayloadPredicates(const TArray<FGameEventPayloadPredicate>& Predicates);
+
+	/** Called on registration, false if the listener cannot run where Execution asks */
+	bool PrepareExecution()
+	{
+		if (Execution == EGameEventExecution::GameThread)
+		{
+			AsyncLambdaFunction.Reset();
+			return true;
+		}
+
+		// UFunction and delegate listeners run on their receiver, which only the game thread may touch
+		if (!LambdaFunction || (Execution == EGameEventExecution::Pipe && PipeName.IsNone()))
+		{
+			return false;
+		}
+		AsyncLambdaFunction = MakeShared<const TFunction<void(const FPropertyContext&)>, ESPMode::ThreadSafe>(LambdaFunction);
+		return true;
 	}
 
 	bool IsValid() const
@@ -151,6 +463,7 @@ struct GAMEEVENTSYSTEM_API FListenerContext
 		}
 
 		Function = Receiver->FindFunction(FName(*FunctionName));
+		FunctionLayout = FGameEventFunctionLayout::Create(Function);
 		return Function != nullptr;
 	}
 
@@ -264,18 +577,123 @@ struct GAMEEVENTSYSTEM_API FListenerContext
 	}
 };
 
+/**
+ * Generational handle of a registered listener.
+ * Packs the listener pool, the slot in that pool and the slot's 32-bit generation in 64 bits: a handle whose listener
+ * was removed never resolves again, even after its slot is reused. Slots are retired before their generation wraps.
+ * The owner id names the bus that issued the handle, a bus rejects the handles of every other one.
+ */
+struct GAMEEVENTSYSTEM_API FGameEventListenerHandle
+{
+	static constexpr uint32 NumPoolBits = 4;
+	static constexpr uint32 NumSlotBits = 28;
+	static constexpr uint32 NumGenerationBits = 32;
+
+	static constexpr uint32 MaxPools = 1u << NumPoolBits;
+	static constexpr uint32 MaxSlots = 1u << NumSlotBits;
+	static constexpr uint32 MaxGeneration = MAX_uint32;
+
+	FGameEventListenerHandle() : Id(0),
+	                             Owner(0)
+	{
+	}
+
+	/** @param Generation Never 0, so a valid handle is never 0 */
+	FGameEventListenerHandle(const uint32 InOwner, const uint32 Pool, const uint32 Slot, const uint32 Generation) : Id(static_cast<uint64>(Pool) |
+	                                                                                                                     (static_cast<uint64>(Slot) << NumPoolBits) |
+	                                                                                                                     (static_cast<uint64>(Generation) << (NumPoolBits + NumSlotBits))),
+	                                                                                                                  Owner(InOwner)
+	{
+	}
+
+	bool IsValid() const
+	{
+		return Id != 0;
+	}
+
+	void Invalidate()
+	{
+		Id = 0;
+		Owner = 0;
+	}
+
+	uint32 GetOwner() const
+	{
+		return Owner;
+	}
+
+	uint32 GetPool() const
+	{
+		return static_cast<uint32>(Id & (MaxPools - 1));
+	}
+
+	uint32 GetSlot() const
+	{
+		return static_cast<uint32>((Id >> NumPoolBits) & (MaxSlots - 1));
+	}
+
+	uint32 GetGeneration() const
+	{
+		return static_cast<uint32>(Id >> (NumPoolBits + NumSlotBits));
+	}
+
+	bool operator==(const FGameEventListenerHandle& Other) const
+	{
+		return Id == Other.Id && Owner == Other.Owner;
+	}
+
+	bool operator!=(const FGameEventListenerHandle& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	friend uint32 GetTypeHash(const FGameEventListenerHandle& Handle)
+	{
+		return HashCombine(GetTypeHash(Handle.Id), Handle.Owner);
+	}
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("Listener_%u_%u_%u_%u"), Owner, GetPool(), GetSlot(), GetGeneration());
+	}
+
+private:
+	uint64 Id;
+
+	uint32 Owner;
+};
+
+/** Listeners of one event sharing a priority, see FGameEventManager::GetEventListenerCountsByPriority */
+struct GAMEEVENTSYSTEM_API FGameEventPriorityBucket
+{
+	int32 Priority = 0;
+
+	int32 NumListeners = 0;
+};
+
+/** Entry of the receiver index: a listener of the receiver and the event it listens to */
 struct GAMEEVENTSYSTEM_API FListener
 {
-	FEventId EventId;
-	FListenerContext Listener;
+	FGameEventHandle EventHandle;
+	FGameEventListenerHandle ListenerHandle;
 
 	FListener()
 	{
 	}
 
+	FListener(const FGameEventHandle InEventHandle, const FGameEventListenerHandle InListenerHandle) : EventHandle(InEventHandle),
+	                                                                                                  ListenerHandle(InListenerHandle)
+	{
+	}
+
 	bool operator==(const FListener& Other) const
 	{
-		return EventId == Other.EventId && Listener == Other.Listener;
+		return ListenerHandle == Other.ListenerHandle;
+	}
+
+	friend uint32 GetTypeHash(const FListener& Entry)
+	{
+		return GetTypeHash(Entry.ListenerHandle);
 	}
 };
 
@@ -297,20 +715,97 @@ struct GAMEEVENTSYSTEM_API FEventContextBase
 	}
 };
 
-struct GAMEEVENTSYSTEM_API FEventContext : FEventContextBase
+/** A registered listener, immutable once registered and shared by its pool slot and every snapshot listing it */
+using FListenerRecord = TSharedRef<const FListenerContext, ESPMode::ThreadSafe>;
+
+/**
+ * Tag filters of a listener list compiled to dense bit masks, one row of words per listener.
+ * Each tag referenced by any filter of the list gets a bit, so the pre-filter of a send is a branch-free AND/compare
+ * loop over the rows instead of a container test per listener. Unfiltered listeners have all-zero rows and pass.
+ */
+class GAMEEVENTSYSTEM_API FGameEventTagFilterTable
+{
+public:
+	FGameEventTagFilterTable() : NumWords(0),
+	                             NumListeners(0)
+	{
+	}
+
+	/** Compile the filters of Listeners, indices of the table follow the list */
+	void Build(const TConstArrayView<FListenerRecord> Listeners);
+
+	/** Whether no listener of the list has a filter, dispatch skips the pre-filter then */
+	bool IsEmpty() const
+	{
+		return NumListeners == 0;
+	}
+
+	/** Set the bit of each listener whose filter accepts the payload */
+	void Evaluate(const FGameplayTagContainer& PayloadTags, TBitArray<>& OutPassed) const;
+
+	/** @return The first tag container or tag parameter of a send, Scratch holds the tag or stays empty */
+	static const FGameplayTagContainer& GetPayloadTags(const TArray<FPropertyContext>& PropertyContexts, FGameplayTagContainer& Scratch);
+
+private:
+	// Bit i of every row stands for Tags[i]
+	TArray<FGameplayTag> Tags;
+
+	int32 NumWords;
+
+	int32 NumListeners;
+
+	TArray<uint64> AnyMasks;
+
+	TArray<uint64> AllMasks;
+
+	TArray<uint64> IgnoreMasks;
+
+	// Listeners whose query does not compile to masks, evaluated after the masks passed
+	TArray<TPair<int32, const FGameplayTagQuery*>> QueryFallbacks;
+};
+
+/**
+ * Immutable, ref-counted listener list of an event, dispatch iterates it without holding any lock.
+ * It references the listener records, so publishing a snapshot never copies a listener.
+ */
+struct GAMEEVENTSYSTEM_API FGameEventListenerSnapshot
 {
-	TArray<FListenerContext> Listeners;
+	TArray<FListenerRecord> Listeners;
+
+	FGameEventTagFilterTable TagFilters;
+
+	/** Compile the tag filters once Listeners is complete */
+	void Finalize()
+	{
+		TagFilters.Build(Listeners);
+	}
+};
+
+using FListenerSnapshot = TSharedPtr<const FGameEventListenerSnapshot, ESPMode::ThreadSafe>;
 
+struct GAMEEVENTSYSTEM_API FEventContext : FEventContextBase
+{
 	TArray<FPropertyContext> PropertyContexts;
 
 	FListenerContext* SpecificTarget;
 
-	FEventContext() : SpecificTarget(nullptr)
+	/**
+	 * Native arguments of a C++ SendEvent as a TGameEventTypedPayload tuple, only valid while the send is dispatched.
+	 * Never stored, queued or pinned: deferred deliveries use PropertyContexts.
+	 */
+	const void* TypedPayload;
+	uint64 TypedPayloadId;
+
+	FEventContext() : SpecificTarget(nullptr),
+	                  TypedPayload(nullptr),
+	                  TypedPayloadId(0)
 	{
 	}
 
 	FEventContext(const FEventContextBase& Context) : FEventContextBase(Context),
-	                                                  SpecificTarget(nullptr)
+	                                                  SpecificTarget(nullptr),
+	                                                  TypedPayload(nullptr),
+	                                                  TypedPayloadId(0)
 	{
 	}
 
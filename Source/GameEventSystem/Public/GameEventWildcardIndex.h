@@ -0,0 +1,152 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameEventTypes.h"
+#include <atomic>
+
+/**
+ * Dispatch index of the wildcard subscriptions of one manager.
+ * A pattern is an event name with wildcard segments: "*" matches exactly one segment, "**" matches any number of
+ * segments including none. "Combat.Damage.*" hears "Combat.Damage.Fire", "UI.**" hears "UI" and everything below it.
+ * Patterns are kept in a segment trie. A sent event is matched by a trie walk under the read lock. An event that some
+ * pattern matches caches a flattened list of their listeners, so its later sends cost one lookup whatever the number
+ * of patterns. The cache is bounded and evicts its oldest lists. Unmatched events only go to a bounded set of handles
+ * that any new pattern clears. When a pattern's listeners change, only the lists of the events it matches are rebuilt.
+ * Names are split in place and their segments are looked up without interning, a segment no pattern names is unknown
+ * and only matches wildcards.
+ */
+class GAMEEVENTSYSTEM_API FGameEventWildcardIndex
+{
+public:
+	FGameEventWildcardIndex();
+
+	/** Whether an event name contains a wildcard segment */
+	static bool IsPattern(const FString& EventName);
+
+	/** Replace the listeners of a pattern, adding the pattern on first use */
+	void SetPatternListeners(const FGameEventHandle PatternHandle, const FListenerSnapshot& Listeners);
+
+	void RemovePattern(const FGameEventHandle PatternHandle);
+
+	/** @return Listeners of every pattern matching the event, nullptr if none does */
+	FListenerSnapshot Find(const FGameEventHandle EventHandle);
+
+	/** Whether a pattern matches a name that has no id yet, nothing is interned or cached */
+	bool HasMatch(const FStringView EventName) const;
+
+	/** Cheap check for senders to skip the lookup */
+	bool IsEmpty() const
+	{
+		return NumPatterns.load(std::memory_order_acquire) == 0;
+	}
+
+	void Empty();
+
+private:
+	/** Cached dispatch lists, the oldest one is evicted past this */
+	static constexpr int32 MaxLeaves = 4096;
+
+	/** Remembered unmatched events, the oldest one is forgotten past this */
+	static constexpr int32 MaxUnmatchedEvents = 16384;
+
+	/** Segments of one name, unknown segments are NAME_None */
+	using FSegments = TArray<FName, TInlineAllocator<8>>;
+
+	/** Trie node, one per distinct pattern prefix */
+	struct FNode
+	{
+		TMap<FName, int32> Children;
+
+		// Child for a "*" segment
+		int32 AnySegmentChild = INDEX_NONE;
+
+		// Child for a "**" segment
+		int32 AnyDepthChild = INDEX_NONE;
+
+		// Pattern ending at this node
+		int32 Pattern = INDEX_NONE;
+	};
+
+	struct FPattern
+	{
+		FGameEventHandle Handle;
+
+		TArray<FName> Segments;
+
+		FListenerSnapshot Listeners;
+
+		// Cached events whose flattened list includes this pattern
+		TSet<FGameEventHandle> MatchedEvents;
+
+		int32 Node = INDEX_NONE;
+	};
+
+	/** Flattened dispatch list of one concrete event */
+	struct FLeaf
+	{
+		TArray<FName> Segments;
+
+		// Sorted by pattern index, so the dispatch order does not depend on when the leaf was built
+		TArray<int32> Patterns;
+
+		FListenerSnapshot Listeners;
+	};
+
+	/** @param FindType FNAME_Find for sent events, FNAME_Add for patterns so the trie holds every literal segment */
+	static void SplitSegments(const FStringView Name, const EFindName FindType, FSegments& OutSegments);
+	static void SplitSegments(const FGameEventHandle Handle, const EFindName FindType, FSegments& OutSegments);
+	static bool MatchSegments(const TConstArrayView<FName> Pattern, const TConstArrayView<FName> Segments);
+
+	/** Hash of the first segments of a name, one per prefix length from 1 to NumSegments */
+	static void HashPrefixes(const TConstArrayView<FName> Segments, const int32 NumSegments, TArray<uint32>& OutHashes);
+
+	// Needs at least the read lock
+	void CollectMatches(const int32 NodeIndex, const TConstArrayView<FName> Segments, TArray<int32>& OutPatterns) const;
+
+	// The following must be called with the write lock held
+	int32 AddPattern(const FGameEventHandle PatternHandle);
+	FLeaf& AddLeaf(const FGameEventHandle EventHandle, const TConstArrayView<FName> Segments, TArray<int32>&& MatchedPatterns);
+	void EvictLeaf(const FGameEventHandle EventHandle);
+	void RebuildLeaf(FLeaf& Leaf) const;
+	void ForgetUnmatchedEvents();
+
+	mutable FRWLock Lock;
+
+	// Node 0 is the root
+	TArray<FNode> Nodes;
+
+	// Removed patterns leave a free slot with no handle, indices held by leaves stay stable
+	TArray<FPattern> Patterns;
+
+	TArray<int32> FreePatterns;
+
+	TMap<FGameEventHandle, int32> PatternIndices;
+
+	TMap<FGameEventHandle, FLeaf> Leaves;
+
+	// Cached events in insertion order, NextLeaf is the oldest once the cache is full
+	TArray<FGameEventHandle> LeafOrder;
+
+	int32 NextLeaf = 0;
+
+	// Cached events by hash of each of their name prefixes, a new pattern only tests the ones sharing its literal prefix
+	TMap<uint32, TSet<FGameEventHandle>> LeavesByPrefix;
+
+	// Has its own lock so recording a miss never blocks the senders reading the leaves. Taken after Lock, never before
+	mutable FRWLock UnmatchedLock;
+
+	TSet<FGameEventHandle> UnmatchedEvents;
+
+	// Remembered unmatched events in insertion order, NextUnmatched is the oldest once the set is full
+	TArray<FGameEventHandle> UnmatchedOrder;
+
+	int32 NextUnmatched = 0;
+
+	// Cached events with an unknown segment, a new pattern may name it so they are matched again
+	TSet<FGameEventHandle> LeavesWithUnknownSegments;
+
+	// Bumped by every pattern change, a match computed under an older value is walked again
+	std::atomic<uint32> PatternGeneration;
+
+	std::atomic<int32> NumPatterns;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameEventWorldSubsystem.generated.h"
+
+class FGameEventManager;
+
+/**
+ * Owns the event bus of one world, created when UGameEventSystemSettings::bPerWorldEventBuses is enabled.
+ * Every world gets its own registry and locks, so PIE clients, servers and automation worlds never see each other's
+ * events, and the whole bus is torn down by dropping it with the world. FGameEventManager::Get() stays the global bus
+ * for cross-world traffic.
+ */
+UCLASS()
+class GAMEEVENTSYSTEM_API UGameEventWorldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem Interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Bus of this world */
+	TSharedPtr<FGameEventManager> GetEventManager() const
+	{
+		return EventManager;
+	}
+
+	/** @return Bus of the world WorldContext belongs to, nullptr if that world has none */
+	static TSharedPtr<FGameEventManager> FindEventManager(const UObject* WorldContext);
+
+private:
+	void OnPostGarbageCollect();
+
+	TSharedPtr<FGameEventManager> EventManager;
+
+	FDelegateHandle PostGarbageCollectDelegate;
+};